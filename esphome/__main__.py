@@ -118,6 +118,7 @@ def run_miniterm(config, port):
     import serial
 
     from esphome import platformio_api
+    from esphome.components.logger.binary_log import get_binary_log_decoder
 
     if CONF_LOGGER not in config:
         _LOGGER.info("Logger is not enabled. Not starting UART logs.")
@@ -129,6 +130,7 @@ def run_miniterm(config, port):
     _LOGGER.info("Starting log output from %s with baud rate %s", port, baud_rate)
 
     backtrace_state = False
+    binary_log_decoder = get_binary_log_decoder(config)
     ser = serial.Serial()
     ser.baudrate = baud_rate
     ser.port = port
@@ -149,6 +151,8 @@ def run_miniterm(config, port):
                     except serial.SerialException:
                         _LOGGER.error("Serial port closed!")
                         return 0
+                    if binary_log_decoder:
+                        raw = binary_log_decoder.decode_serial_line(raw)
                     line = (
                         raw.replace(b"\r", b"")
                         .replace(b"\n", b"")
@@ -3,10 +3,21 @@ import esphome.config_validation as cv
 from esphome.components import uart
 from esphome.components.light.types import AddressableLightEffect
 from esphome.components.light.effects import register_addressable_effect
+from esphome.components.light.streaming import (
+    CONF_STREAMING,
+    STREAMING_SCHEMA,
+    setup_streaming,
+    streaming_auto_load,
+)
 from esphome.const import CONF_NAME, CONF_UART_ID
 
 DEPENDENCIES = ["uart"]
 
+
+def AUTO_LOAD():
+    return streaming_auto_load("adalight")
+
+
 adalight_ns = cg.esphome_ns.namespace("adalight")
 AdalightLightEffect = adalight_ns.class_(
     "AdalightLightEffect", uart.UARTDevice, AddressableLightEffect
@@ -19,9 +30,13 @@ CONFIG_SCHEMA = cv.Schema({})
     "adalight",
     AdalightLightEffect,
     "Adalight",
-    {cv.GenerateID(CONF_UART_ID): cv.use_id(uart.UARTComponent)},
+    {
+        cv.GenerateID(CONF_UART_ID): cv.use_id(uart.UARTComponent),
+        cv.Optional(CONF_STREAMING): STREAMING_SCHEMA,
+    },
 )
 async def adalight_light_effect_to_code(config, effect_id):
     effect = cg.new_Pvariable(effect_id, config[CONF_NAME])
     await uart.register_uart_device(effect, config)
+    await setup_streaming(effect, config)
     return effect
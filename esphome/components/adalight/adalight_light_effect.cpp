@@ -17,10 +17,17 @@ void AdalightLightEffect::start() {
   last_ack_ = 0;
   last_byte_ = 0;
   last_reset_ = 0;
+
+  if (this->stream_ != nullptr) {
+    this->stream_->start(this->get_addressable_()->size());
+  }
 }
 
 void AdalightLightEffect::stop() {
   frame_.resize(0);
+  if (this->stream_ != nullptr) {
+    this->stream_->stop();
+  }
 
   AddressableLightEffect::stop();
 }
@@ -41,10 +48,11 @@ void AdalightLightEffect::reset_frame_(light::AddressableLight &it) {
 }
 
 void AdalightLightEffect::blank_all_leds_(light::AddressableLight &it) {
-  for (int led = it.size(); led-- > 0;) {
-    it[led].set(Color::BLACK);
-  }
+  it.all() = Color::BLACK;
   it.schedule_show();
+  if (this->is_streaming_()) {
+    this->stream_->clear();
+  }
 }
 
 void AdalightLightEffect::apply(light::AddressableLight &it, const Color &current_color) {
@@ -95,6 +103,10 @@ void AdalightLightEffect::apply(light::AddressableLight &it, const Color &curren
         break;
     }
   }
+
+  if (this->is_streaming_()) {
+    this->stream_->apply(it);
+  }
 }
 
 AdalightLightEffect::Frame AdalightLightEffect::parse_frame_(light::AddressableLight &it) {
@@ -128,13 +140,23 @@ AdalightLightEffect::Frame AdalightLightEffect::parse_frame_(light::AddressableL
   auto accepted_led_count = std::min<int>(led_count, it.size());
   uint8_t *led_data = &frame_[6];
 
+  Color *frame = this->is_streaming_() ? this->stream_->frame() : nullptr;
   for (int led = 0; led < accepted_led_count; led++, led_data += 3) {
     auto white = std::min(std::min(led_data[0], led_data[1]), led_data[2]);
+    const Color color(led_data[0], led_data[1], led_data[2], white);
 
-    it[led].set(Color(led_data[0], led_data[1], led_data[2], white));
+    if (frame != nullptr) {
+      frame[led] = color;
+    } else {
+      it[led] = color;
+    }
   }
 
-  it.schedule_show();
+  if (frame != nullptr) {
+    this->stream_->commit();
+  } else {
+    it.schedule_show();
+  }
   return CONSUMED;
 }
 
@@ -2,6 +2,7 @@
 
 #include "esphome/core/component.h"
 #include "esphome/components/light/addressable_light_effect.h"
+#include "esphome/components/light/addressable_light_stream.h"
 #include "esphome/components/uart/uart.h"
 
 #include <vector>
@@ -16,6 +17,7 @@ class AdalightLightEffect : public light::AddressableLightEffect, public uart::U
   void start() override;
   void stop() override;
   void apply(light::AddressableLight &it, const Color &current_color) override;
+  void set_stream(light::AddressableLightStream *stream) { this->stream_ = stream; }
 
  protected:
   enum Frame {
@@ -28,7 +30,9 @@ class AdalightLightEffect : public light::AddressableLightEffect, public uart::U
   void reset_frame_(light::AddressableLight &it);
   void blank_all_leds_(light::AddressableLight &it);
   Frame parse_frame_(light::AddressableLight &it);
+  bool is_streaming_() const { return this->stream_ != nullptr && this->stream_->is_started(); }
 
+  light::AddressableLightStream *stream_{nullptr};
   uint32_t last_ack_{0};
   uint32_t last_byte_{0};
   uint32_t last_reset_{0};
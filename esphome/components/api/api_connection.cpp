@@ -26,6 +26,10 @@ namespace api {
 
 static const char *const TAG = "api.connection";
 static const int ESP32_CAMERA_STOP_STREAM = 5000;
+// Entities sent per loop iteration while listing entities or sending the initial states
+static const uint8_t MAX_ITERATOR_STEPS_PER_LOOP = 32;
+// Flush a batch early once it fills about one TCP segment
+static const size_t MAX_BATCH_SIZE_BYTES = 1460;
 
 APIConnection::APIConnection(std::unique_ptr<socket::Socket> sock, APIServer *parent)
     : parent_(parent), initial_state_iterator_(this), list_entities_iterator_(this) {
@@ -80,6 +84,7 @@ void APIConnection::loop() {
   }
   if (this->next_close_) {
     // requested a disconnect
+    this->flush_batch_();
     this->helper_->close();
     this->remove_ = true;
     return;
@@ -115,8 +120,16 @@ void APIConnection::loop() {
       return;
   }
 
-  this->list_entities_iterator_.advance();
-  this->initial_state_iterator_.advance();
+  // Send several entities per loop iteration, they all end up in the same batch. The iterators stop by themselves
+  // once a flush could not write everything to the socket.
+  for (uint8_t i = 0; i < MAX_ITERATOR_STEPS_PER_LOOP; i++) {
+    if (this->list_entities_iterator_.completed() && this->initial_state_iterator_.completed())
+      break;
+    if (!this->helper_->can_write_without_blocking())
+      break;
+    this->list_entities_iterator_.advance();
+    this->initial_state_iterator_.advance();
+  }
 
   static uint32_t keepalive = 60000;
   static uint8_t max_ping_retries = 60;
@@ -151,13 +164,18 @@ void APIConnection::loop() {
 #ifdef USE_ESP32_CAMERA
   if (this->image_reader_.available() && this->helper_->can_write_without_blocking()) {
     uint32_t to_send = std::min((size_t) 1024, this->image_reader_.available());
-    auto buffer = this->create_buffer();
+    uint32_t key = esp32_camera::global_esp32_camera->get_object_id_hash();
+    bool done = this->image_reader_.available() == to_send;
+    uint32_t msg_size = 0;
+    ProtoSize::add_fixed32_field(msg_size, 1, key);
+    ProtoSize::add_string_field(msg_size, 2, to_send);
+    ProtoSize::add_bool_field(msg_size, 3, done);
+    auto buffer = this->create_buffer(msg_size);
     // fixed32 key = 1;
-    buffer.encode_fixed32(1, esp32_camera::global_esp32_camera->get_object_id_hash());
+    buffer.encode_fixed32(1, key);
     // bytes data = 2;
     buffer.encode_bytes(2, this->image_reader_.peek_data_buffer(), to_send);
     // bool done = 3;
-    bool done = this->image_reader_.available() == to_send;
     buffer.encode_bool(3, done);
     bool success = this->send_buffer(buffer, 44);
 
@@ -184,6 +202,12 @@ void APIConnection::loop() {
       }
     }
   }
+
+  // State updates come last, responses and logs sent above already sit in the batch ahead of them
+  this->process_pending_states_();
+
+  if (!this->batch_.empty() && now - this->batch_start_time_ >= this->parent_->get_batch_delay())
+    this->flush_batch_();
 }
 
 std::string get_default_unique_id(const std::string &component_type, EntityBase *entity) {
@@ -205,12 +229,15 @@ void APIConnection::on_disconnect_response(const DisconnectResponse &value) {
 
 #ifdef USE_BINARY_SENSOR
 bool APIConnection::send_binary_sensor_state(binary_sensor::BinarySensor *binary_sensor, bool state) {
+  return this->schedule_state_(binary_sensor, StateType::BINARY_SENSOR);
+}
+bool APIConnection::try_send_binary_sensor_state_(binary_sensor::BinarySensor *binary_sensor) {
   if (!this->state_subscription_)
     return false;
 
   BinarySensorStateResponse resp;
   resp.key = binary_sensor->get_object_id_hash();
-  resp.state = state;
+  resp.state = binary_sensor->state;
   resp.missing_state = !binary_sensor->has_state();
   return this->send_binary_sensor_state_response(resp);
 }
@@ -232,6 +259,9 @@ bool APIConnection::send_binary_sensor_info(binary_sensor::BinarySensor *binary_
 
 #ifdef USE_COVER
 bool APIConnection::send_cover_state(cover::Cover *cover) {
+  return this->schedule_state_(cover, StateType::COVER);
+}
+bool APIConnection::try_send_cover_state_(cover::Cover *cover) {
   if (!this->state_subscription_)
     return false;
 
@@ -295,6 +325,9 @@ void APIConnection::cover_command(const CoverCommandRequest &msg) {
 
 #ifdef USE_FAN
 bool APIConnection::send_fan_state(fan::Fan *fan) {
+  return this->schedule_state_(fan, StateType::FAN);
+}
+bool APIConnection::try_send_fan_state_(fan::Fan *fan) {
   if (!this->state_subscription_)
     return false;
 
@@ -356,6 +389,9 @@ void APIConnection::fan_command(const FanCommandRequest &msg) {
 
 #ifdef USE_LIGHT
 bool APIConnection::send_light_state(light::LightState *light) {
+  return this->schedule_state_(light, StateType::LIGHT);
+}
+bool APIConnection::try_send_light_state_(light::LightState *light) {
   if (!this->state_subscription_)
     return false;
 
@@ -454,12 +490,15 @@ void APIConnection::light_command(const LightCommandRequest &msg) {
 
 #ifdef USE_SENSOR
 bool APIConnection::send_sensor_state(sensor::Sensor *sensor, float state) {
+  return this->schedule_state_(sensor, StateType::SENSOR);
+}
+bool APIConnection::try_send_sensor_state_(sensor::Sensor *sensor) {
   if (!this->state_subscription_)
     return false;
 
   SensorStateResponse resp{};
   resp.key = sensor->get_object_id_hash();
-  resp.state = state;
+  resp.state = sensor->state;
   resp.missing_state = !sensor->has_state();
   return this->send_sensor_state_response(resp);
 }
@@ -486,12 +525,15 @@ bool APIConnection::send_sensor_info(sensor::Sensor *sensor) {
 
 #ifdef USE_SWITCH
 bool APIConnection::send_switch_state(switch_::Switch *a_switch, bool state) {
+  return this->schedule_state_(a_switch, StateType::SWITCH);
+}
+bool APIConnection::try_send_switch_state_(switch_::Switch *a_switch) {
   if (!this->state_subscription_)
     return false;
 
   SwitchStateResponse resp{};
   resp.key = a_switch->get_object_id_hash();
-  resp.state = state;
+  resp.state = a_switch->state;
   return this->send_switch_state_response(resp);
 }
 bool APIConnection::send_switch_info(switch_::Switch *a_switch) {
@@ -523,12 +565,15 @@ void APIConnection::switch_command(const SwitchCommandRequest &msg) {
 
 #ifdef USE_TEXT_SENSOR
 bool APIConnection::send_text_sensor_state(text_sensor::TextSensor *text_sensor, std::string state) {
+  return this->schedule_state_(text_sensor, StateType::TEXT_SENSOR);
+}
+bool APIConnection::try_send_text_sensor_state_(text_sensor::TextSensor *text_sensor) {
   if (!this->state_subscription_)
     return false;
 
   TextSensorStateResponse resp{};
   resp.key = text_sensor->get_object_id_hash();
-  resp.state = std::move(state);
+  resp.state = text_sensor->state;
   resp.missing_state = !text_sensor->has_state();
   return this->send_text_sensor_state_response(resp);
 }
@@ -550,6 +595,9 @@ bool APIConnection::send_text_sensor_info(text_sensor::TextSensor *text_sensor)
 
 #ifdef USE_CLIMATE
 bool APIConnection::send_climate_state(climate::Climate *climate) {
+  return this->schedule_state_(climate, StateType::CLIMATE);
+}
+bool APIConnection::try_send_climate_state_(climate::Climate *climate) {
   if (!this->state_subscription_)
     return false;
 
@@ -658,12 +706,15 @@ void APIConnection::climate_command(const ClimateCommandRequest &msg) {
 
 #ifdef USE_NUMBER
 bool APIConnection::send_number_state(number::Number *number, float state) {
+  return this->schedule_state_(number, StateType::NUMBER);
+}
+bool APIConnection::try_send_number_state_(number::Number *number) {
   if (!this->state_subscription_)
     return false;
 
   NumberStateResponse resp{};
   resp.key = number->get_object_id_hash();
-  resp.state = state;
+  resp.state = number->state;
   resp.missing_state = !number->has_state();
   return this->send_number_state_response(resp);
 }
@@ -700,6 +751,9 @@ void APIConnection::number_command(const NumberCommandRequest &msg) {
 
 #ifdef USE_DATETIME_DATE
 bool APIConnection::send_date_state(datetime::DateEntity *date) {
+  return this->schedule_state_(date, StateType::DATE);
+}
+bool APIConnection::try_send_date_state_(datetime::DateEntity *date) {
   if (!this->state_subscription_)
     return false;
 
@@ -737,6 +791,9 @@ void APIConnection::date_command(const DateCommandRequest &msg) {
 
 #ifdef USE_DATETIME_TIME
 bool APIConnection::send_time_state(datetime::TimeEntity *time) {
+  return this->schedule_state_(time, StateType::TIME);
+}
+bool APIConnection::try_send_time_state_(datetime::TimeEntity *time) {
   if (!this->state_subscription_)
     return false;
 
@@ -774,6 +831,9 @@ void APIConnection::time_command(const TimeCommandRequest &msg) {
 
 #ifdef USE_DATETIME_DATETIME
 bool APIConnection::send_datetime_state(datetime::DateTimeEntity *datetime) {
+  return this->schedule_state_(datetime, StateType::DATETIME);
+}
+bool APIConnection::try_send_datetime_state_(datetime::DateTimeEntity *datetime) {
   if (!this->state_subscription_)
     return false;
 
@@ -812,12 +872,15 @@ void APIConnection::datetime_command(const DateTimeCommandRequest &msg) {
 
 #ifdef USE_TEXT
 bool APIConnection::send_text_state(text::Text *text, std::string state) {
+  return this->schedule_state_(text, StateType::TEXT);
+}
+bool APIConnection::try_send_text_state_(text::Text *text) {
   if (!this->state_subscription_)
     return false;
 
   TextStateResponse resp{};
   resp.key = text->get_object_id_hash();
-  resp.state = std::move(state);
+  resp.state = text->state;
   resp.missing_state = !text->has_state();
   return this->send_text_state_response(resp);
 }
@@ -850,12 +913,15 @@ void APIConnection::text_command(const TextCommandRequest &msg) {
 
 #ifdef USE_SELECT
 bool APIConnection::send_select_state(select::Select *select, std::string state) {
+  return this->schedule_state_(select, StateType::SELECT);
+}
+bool APIConnection::try_send_select_state_(select::Select *select) {
   if (!this->state_subscription_)
     return false;
 
   SelectStateResponse resp{};
   resp.key = select->get_object_id_hash();
-  resp.state = std::move(state);
+  resp.state = select->state;
   resp.missing_state = !select->has_state();
   return this->send_select_state_response(resp);
 }
@@ -911,12 +977,15 @@ void APIConnection::button_command(const ButtonCommandRequest &msg) {
 
 #ifdef USE_LOCK
 bool APIConnection::send_lock_state(lock::Lock *a_lock, lock::LockState state) {
+  return this->schedule_state_(a_lock, StateType::LOCK);
+}
+bool APIConnection::try_send_lock_state_(lock::Lock *a_lock) {
   if (!this->state_subscription_)
     return false;
 
   LockStateResponse resp{};
   resp.key = a_lock->get_object_id_hash();
-  resp.state = static_cast<enums::LockState>(state);
+  resp.state = static_cast<enums::LockState>(a_lock->state);
   return this->send_lock_state_response(resp);
 }
 bool APIConnection::send_lock_info(lock::Lock *a_lock) {
@@ -955,6 +1024,9 @@ void APIConnection::lock_command(const LockCommandRequest &msg) {
 
 #ifdef USE_VALVE
 bool APIConnection::send_valve_state(valve::Valve *valve) {
+  return this->schedule_state_(valve, StateType::VALVE);
+}
+bool APIConnection::try_send_valve_state_(valve::Valve *valve) {
   if (!this->state_subscription_)
     return false;
 
@@ -997,6 +1069,9 @@ void APIConnection::valve_command(const ValveCommandRequest &msg) {
 
 #ifdef USE_MEDIA_PLAYER
 bool APIConnection::send_media_player_state(media_player::MediaPlayer *media_player) {
+  return this->schedule_state_(media_player, StateType::MEDIA_PLAYER);
+}
+bool APIConnection::try_send_media_player_state_(media_player::MediaPlayer *media_player) {
   if (!this->state_subscription_)
     return false;
 
@@ -1207,6 +1282,9 @@ void APIConnection::on_voice_assistant_timer_event_response(const VoiceAssistant
 
 #ifdef USE_ALARM_CONTROL_PANEL
 bool APIConnection::send_alarm_control_panel_state(alarm_control_panel::AlarmControlPanel *a_alarm_control_panel) {
+  return this->schedule_state_(a_alarm_control_panel, StateType::ALARM_CONTROL_PANEL);
+}
+bool APIConnection::try_send_alarm_control_panel_state_(alarm_control_panel::AlarmControlPanel *a_alarm_control_panel) {
   if (!this->state_subscription_)
     return false;
 
@@ -1263,6 +1341,28 @@ void APIConnection::alarm_control_panel_command(const AlarmControlPanelCommandRe
 }
 #endif
 
+#ifdef USE_PROFILER
+ProfilerStatsResponse APIConnection::profiler_stats(const ProfilerStatsRequest &msg) {
+  ProfilerStatsResponse resp;
+  for (const auto &entry : App.profiler.get_entries()) {
+    if (!entry.used)
+      continue;
+    ProfilerStatsEntry stats;
+    stats.source = entry.component == nullptr ? "<unknown>" : entry.component->get_component_source();
+    stats.kind = static_cast<enums::ProfilerEntryKind>(entry.kind);
+    stats.id = entry.id;
+    stats.count = entry.count;
+    stats.min_us = entry.min_us;
+    stats.avg_us = entry.get_avg_us();
+    stats.max_us = entry.max_us;
+    stats.p99_us = entry.get_percentile_us(0.99f);
+    resp.entries.push_back(std::move(stats));
+  }
+  resp.dropped = App.profiler.get_dropped();
+  return resp;
+}
+#endif
+
 #ifdef USE_EVENT
 bool APIConnection::send_event(event::Event *event, std::string event_type) {
   EventResponse resp{};
@@ -1289,6 +1389,9 @@ bool APIConnection::send_event_info(event::Event *event) {
 
 #ifdef USE_UPDATE
 bool APIConnection::send_update_state(update::UpdateEntity *update) {
+  return this->schedule_state_(update, StateType::UPDATE);
+}
+bool APIConnection::try_send_update_state_(update::UpdateEntity *update) {
   if (!this->state_subscription_)
     return false;
 
@@ -1345,16 +1448,22 @@ void APIConnection::update_command(const UpdateCommandRequest &msg) {
 }
 #endif
 
-bool APIConnection::send_log_message(int level, const char *tag, const char *line) {
+bool APIConnection::send_log_message(int level, const char *tag, const char *line, size_t line_length) {
   if (this->log_subscription_ < level)
     return false;
+  // the frame helper logs while it has the batch buffer in use
+  if (this->flushing_batch_)
+    return false;
 
   // Send raw so that we don't copy too much
-  auto buffer = this->create_buffer();
+  uint32_t msg_size = 0;
+  ProtoSize::add_uint32_field(msg_size, 1, static_cast<uint32_t>(level));
+  ProtoSize::add_string_field(msg_size, 3, line_length);
+  auto buffer = this->create_buffer(msg_size);
   // LogLevel level = 1;
   buffer.encode_uint32(1, static_cast<uint32_t>(level));
   // string message = 3;
-  buffer.encode_string(3, line, strlen(line));
+  buffer.encode_string(3, line, line_length);
   // SubscribeLogsResponse - 29
   return this->send_buffer(buffer, 29);
 }
@@ -1458,7 +1567,26 @@ void APIConnection::execute_service(const ExecuteServiceRequest &msg) {
 void APIConnection::subscribe_home_assistant_states(const SubscribeHomeAssistantStatesRequest &msg) {
   state_subs_at_ = 0;
 }
+ProtoWriteBuffer APIConnection::create_buffer(uint32_t reserve_size) {
+  // FIXME: ensure no recursive writes can happen
+  // Messages are appended behind the batched ones, with room for the frame header in front of the message. The
+  // frame helper fills in header and footer in place, so a message is never copied after it has been encoded.
+  const size_t frame_offset = this->batch_end_();
+  const uint8_t header_padding = this->helper_->frame_header_padding();
+  const size_t needed = frame_offset + header_padding + reserve_size + this->helper_->frame_footer_size();
+  if (needed > this->proto_write_buffer_.capacity())
+    this->proto_write_buffer_.reserve(std::max(needed, this->proto_write_buffer_.capacity() * 2));
+  this->proto_write_buffer_.resize(frame_offset + header_padding);
+  return {&this->proto_write_buffer_};
+}
+size_t APIConnection::batch_end_() const {
+  if (this->batch_.empty())
+    return 0;
+  const PacketInfo &last = this->batch_.back();
+  return last.offset + this->helper_->frame_header_padding() + last.payload_size + this->helper_->frame_footer_size();
+}
 bool APIConnection::send_buffer(ProtoWriteBuffer buffer, uint32_t message_type) {
+  const size_t frame_offset = this->batch_end_();
   if (this->remove_)
     return false;
   if (!this->helper_->can_write_without_blocking()) {
@@ -1475,12 +1603,34 @@ bool APIConnection::send_buffer(ProtoWriteBuffer buffer, uint32_t message_type)
       if (message_type != 29) {
         ESP_LOGV(TAG, "Cannot send message because of TCP buffer space");
       }
+      // drop the message, but keep the ones that are already batched
+      this->proto_write_buffer_.resize(frame_offset);
       delay(0);
       return false;
     }
   }
 
-  APIError err = this->helper_->write_packet(message_type, buffer.get_buffer()->data(), buffer.get_buffer()->size());
+  const uint32_t payload_size = this->proto_write_buffer_.size() - frame_offset - this->helper_->frame_header_padding();
+  this->proto_write_buffer_.resize(this->proto_write_buffer_.size() + this->helper_->frame_footer_size());
+  if (this->batch_.empty())
+    this->batch_start_time_ = millis();
+  this->batch_.push_back(
+      PacketInfo{static_cast<uint32_t>(frame_offset), payload_size, static_cast<uint16_t>(message_type)});
+
+  if (this->proto_write_buffer_.size() >= MAX_BATCH_SIZE_BYTES)
+    return this->flush_batch_();
+  return true;
+}
+bool APIConnection::flush_batch_() {
+  if (this->batch_.empty())
+    return true;
+
+  this->flushing_batch_ = true;
+  APIError err = this->helper_->write_protobuf_packets(ProtoWriteBuffer{&this->proto_write_buffer_},
+                                                       this->batch_.data(), this->batch_.size());
+  this->flushing_batch_ = false;
+  this->batch_.clear();
+  this->proto_write_buffer_.clear();
   if (err == APIError::WOULD_BLOCK)
     return false;
   if (err != APIError::OK) {
@@ -1496,6 +1646,110 @@ bool APIConnection::send_buffer(ProtoWriteBuffer buffer, uint32_t message_type)
   // Do not set last_traffic_ on send
   return true;
 }
+bool APIConnection::schedule_state_(EntityBase *entity, StateType type) {
+  if (!this->state_subscription_)
+    return false;
+  // The state is read from the entity when the update is sent, so a queued update always carries the latest state
+  // and a newer update for the same entity doesn't need another entry. This bounds the queue to one entry per entity.
+  for (auto &pending : this->pending_states_) {
+    if (pending.entity == entity)
+      return true;
+  }
+  this->pending_states_.push_back(PendingState{entity, type});
+  return true;
+}
+void APIConnection::process_pending_states_() {
+  size_t sent = 0;
+  while (sent < this->pending_states_.size() && this->helper_->can_write_without_blocking()) {
+    if (!this->try_send_state_(this->pending_states_[sent]))
+      break;
+    sent++;
+  }
+  this->pending_states_.erase(this->pending_states_.begin(), this->pending_states_.begin() + sent);
+}
+bool APIConnection::try_send_state_(const PendingState &pending) {
+  switch (pending.type) {
+#ifdef USE_BINARY_SENSOR
+    case StateType::BINARY_SENSOR:
+      return this->try_send_binary_sensor_state_(static_cast<binary_sensor::BinarySensor *>(pending.entity));
+#endif
+#ifdef USE_COVER
+    case StateType::COVER:
+      return this->try_send_cover_state_(static_cast<cover::Cover *>(pending.entity));
+#endif
+#ifdef USE_FAN
+    case StateType::FAN:
+      return this->try_send_fan_state_(static_cast<fan::Fan *>(pending.entity));
+#endif
+#ifdef USE_LIGHT
+    case StateType::LIGHT:
+      return this->try_send_light_state_(static_cast<light::LightState *>(pending.entity));
+#endif
+#ifdef USE_SENSOR
+    case StateType::SENSOR:
+      return this->try_send_sensor_state_(static_cast<sensor::Sensor *>(pending.entity));
+#endif
+#ifdef USE_SWITCH
+    case StateType::SWITCH:
+      return this->try_send_switch_state_(static_cast<switch_::Switch *>(pending.entity));
+#endif
+#ifdef USE_TEXT_SENSOR
+    case StateType::TEXT_SENSOR:
+      return this->try_send_text_sensor_state_(static_cast<text_sensor::TextSensor *>(pending.entity));
+#endif
+#ifdef USE_CLIMATE
+    case StateType::CLIMATE:
+      return this->try_send_climate_state_(static_cast<climate::Climate *>(pending.entity));
+#endif
+#ifdef USE_NUMBER
+    case StateType::NUMBER:
+      return this->try_send_number_state_(static_cast<number::Number *>(pending.entity));
+#endif
+#ifdef USE_DATETIME_DATE
+    case StateType::DATE:
+      return this->try_send_date_state_(static_cast<datetime::DateEntity *>(pending.entity));
+#endif
+#ifdef USE_DATETIME_TIME
+    case StateType::TIME:
+      return this->try_send_time_state_(static_cast<datetime::TimeEntity *>(pending.entity));
+#endif
+#ifdef USE_DATETIME_DATETIME
+    case StateType::DATETIME:
+      return this->try_send_datetime_state_(static_cast<datetime::DateTimeEntity *>(pending.entity));
+#endif
+#ifdef USE_TEXT
+    case StateType::TEXT:
+      return this->try_send_text_state_(static_cast<text::Text *>(pending.entity));
+#endif
+#ifdef USE_SELECT
+    case StateType::SELECT:
+      return this->try_send_select_state_(static_cast<select::Select *>(pending.entity));
+#endif
+#ifdef USE_LOCK
+    case StateType::LOCK:
+      return this->try_send_lock_state_(static_cast<lock::Lock *>(pending.entity));
+#endif
+#ifdef USE_VALVE
+    case StateType::VALVE:
+      return this->try_send_valve_state_(static_cast<valve::Valve *>(pending.entity));
+#endif
+#ifdef USE_MEDIA_PLAYER
+    case StateType::MEDIA_PLAYER:
+      return this->try_send_media_player_state_(static_cast<media_player::MediaPlayer *>(pending.entity));
+#endif
+#ifdef USE_ALARM_CONTROL_PANEL
+    case StateType::ALARM_CONTROL_PANEL:
+      return this->try_send_alarm_control_panel_state_(
+          static_cast<alarm_control_panel::AlarmControlPanel *>(pending.entity));
+#endif
+#ifdef USE_UPDATE
+    case StateType::UPDATE:
+      return this->try_send_update_state_(static_cast<update::UpdateEntity *>(pending.entity));
+#endif
+    default:
+      return true;
+  }
+}
 void APIConnection::on_unauthenticated_access() {
   this->on_fatal_error();
   ESP_LOGD(TAG, "%s: tried to access without authentication.", this->client_combined_info_.c_str());
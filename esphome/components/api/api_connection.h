@@ -116,7 +116,10 @@ class APIConnection : public APIServerConnection {
   bool send_media_player_info(media_player::MediaPlayer *media_player);
   void media_player_command(const MediaPlayerCommandRequest &msg) override;
 #endif
-  bool send_log_message(int level, const char *tag, const char *line);
+  bool send_log_message(int level, const char *tag, const char *line) {
+    return this->send_log_message(level, tag, line, strlen(line));
+  }
+  bool send_log_message(int level, const char *tag, const char *line, size_t line_length);
   void send_homeassistant_service_call(const HomeassistantServiceResponse &call) {
     if (!this->service_call_subscription_)
       return;
@@ -159,6 +162,10 @@ class APIConnection : public APIServerConnection {
   void alarm_control_panel_command(const AlarmControlPanelCommandRequest &msg) override;
 #endif
 
+#ifdef USE_PROFILER
+  ProfilerStatsResponse profiler_stats(const ProfilerStatsRequest &msg) override;
+#endif
+
 #ifdef USE_EVENT
   bool send_event(event::Event *event, std::string event_type);
   bool send_event_info(event::Event *event);
@@ -212,12 +219,10 @@ class APIConnection : public APIServerConnection {
   void on_fatal_error() override;
   void on_unauthenticated_access() override;
   void on_no_setup_connection() override;
-  ProtoWriteBuffer create_buffer() override {
-    // FIXME: ensure no recursive writes can happen
-    this->proto_write_buffer_.clear();
-    return {&this->proto_write_buffer_};
-  }
+  ProtoWriteBuffer create_buffer(uint32_t reserve_size) override;
   bool send_buffer(ProtoWriteBuffer buffer, uint32_t message_type) override;
+  /// Write any batched messages now instead of waiting for the next loop.
+  bool flush_batch() { return this->flush_batch_(); }
 
   std::string get_client_combined_info() const { return this->client_combined_info_; }
 
@@ -225,6 +230,137 @@ class APIConnection : public APIServerConnection {
   friend APIServer;
 
   bool send_(const void *buf, size_t len, bool force);
+  /// Entity types whose state updates are coalesced in pending_states_.
+  enum class StateType : uint8_t {
+#ifdef USE_BINARY_SENSOR
+    BINARY_SENSOR,
+#endif
+#ifdef USE_COVER
+    COVER,
+#endif
+#ifdef USE_FAN
+    FAN,
+#endif
+#ifdef USE_LIGHT
+    LIGHT,
+#endif
+#ifdef USE_SENSOR
+    SENSOR,
+#endif
+#ifdef USE_SWITCH
+    SWITCH,
+#endif
+#ifdef USE_TEXT_SENSOR
+    TEXT_SENSOR,
+#endif
+#ifdef USE_CLIMATE
+    CLIMATE,
+#endif
+#ifdef USE_NUMBER
+    NUMBER,
+#endif
+#ifdef USE_DATETIME_DATE
+    DATE,
+#endif
+#ifdef USE_DATETIME_TIME
+    TIME,
+#endif
+#ifdef USE_DATETIME_DATETIME
+    DATETIME,
+#endif
+#ifdef USE_TEXT
+    TEXT,
+#endif
+#ifdef USE_SELECT
+    SELECT,
+#endif
+#ifdef USE_LOCK
+    LOCK,
+#endif
+#ifdef USE_VALVE
+    VALVE,
+#endif
+#ifdef USE_MEDIA_PLAYER
+    MEDIA_PLAYER,
+#endif
+#ifdef USE_ALARM_CONTROL_PANEL
+    ALARM_CONTROL_PANEL,
+#endif
+#ifdef USE_UPDATE
+    UPDATE,
+#endif
+  };
+  struct PendingState {
+    EntityBase *entity;
+    StateType type;
+  };
+  /// Queue a state update for \p entity, replacing an update for the same entity that is still queued.
+  bool schedule_state_(EntityBase *entity, StateType type);
+  /// Send queued state updates for as long as the socket accepts data.
+  void process_pending_states_();
+  /// Encode the current state of a queued entity. Returns false if it couldn't be sent.
+  bool try_send_state_(const PendingState &pending);
+#ifdef USE_BINARY_SENSOR
+  bool try_send_binary_sensor_state_(binary_sensor::BinarySensor *binary_sensor);
+#endif
+#ifdef USE_COVER
+  bool try_send_cover_state_(cover::Cover *cover);
+#endif
+#ifdef USE_FAN
+  bool try_send_fan_state_(fan::Fan *fan);
+#endif
+#ifdef USE_LIGHT
+  bool try_send_light_state_(light::LightState *light);
+#endif
+#ifdef USE_SENSOR
+  bool try_send_sensor_state_(sensor::Sensor *sensor);
+#endif
+#ifdef USE_SWITCH
+  bool try_send_switch_state_(switch_::Switch *a_switch);
+#endif
+#ifdef USE_TEXT_SENSOR
+  bool try_send_text_sensor_state_(text_sensor::TextSensor *text_sensor);
+#endif
+#ifdef USE_CLIMATE
+  bool try_send_climate_state_(climate::Climate *climate);
+#endif
+#ifdef USE_NUMBER
+  bool try_send_number_state_(number::Number *number);
+#endif
+#ifdef USE_DATETIME_DATE
+  bool try_send_date_state_(datetime::DateEntity *date);
+#endif
+#ifdef USE_DATETIME_TIME
+  bool try_send_time_state_(datetime::TimeEntity *time);
+#endif
+#ifdef USE_DATETIME_DATETIME
+  bool try_send_datetime_state_(datetime::DateTimeEntity *datetime);
+#endif
+#ifdef USE_TEXT
+  bool try_send_text_state_(text::Text *text);
+#endif
+#ifdef USE_SELECT
+  bool try_send_select_state_(select::Select *select);
+#endif
+#ifdef USE_LOCK
+  bool try_send_lock_state_(lock::Lock *a_lock);
+#endif
+#ifdef USE_VALVE
+  bool try_send_valve_state_(valve::Valve *valve);
+#endif
+#ifdef USE_MEDIA_PLAYER
+  bool try_send_media_player_state_(media_player::MediaPlayer *media_player);
+#endif
+#ifdef USE_ALARM_CONTROL_PANEL
+  bool try_send_alarm_control_panel_state_(alarm_control_panel::AlarmControlPanel *a_alarm_control_panel);
+#endif
+#ifdef USE_UPDATE
+  bool try_send_update_state_(update::UpdateEntity *update);
+#endif
+  /// End of the last batched frame in proto_write_buffer_.
+  size_t batch_end_() const;
+  /// Hand all batched messages to the frame helper in a single write. Returns false on a fatal error.
+  bool flush_batch_();
 
   enum class ConnectionState {
     WAITING_FOR_HELLO,
@@ -237,6 +373,12 @@ class APIConnection : public APIServerConnection {
   // Buffer used to encode proto messages
   // Re-use to prevent allocations
   std::vector<uint8_t> proto_write_buffer_;
+  // Messages in proto_write_buffer_ waiting to be written, flushed at the end of loop() once the batch delay expired
+  std::vector<PacketInfo> batch_;
+  uint32_t batch_start_time_{0};
+  bool flushing_batch_{false};
+  // State updates waiting for socket capacity, at most one per entity and oldest first
+  std::vector<PendingState> pending_states_;
   std::unique_ptr<APIFrameHelper> helper_;
 
   std::string client_info_;
@@ -5,6 +5,7 @@
 #include "esphome/core/helpers.h"
 #include "esphome/core/application.h"
 #include "proto.h"
+#include <cinttypes>
 #include <cstring>
 
 namespace esphome {
@@ -467,7 +468,8 @@ APIError APINoiseFrameHelper::read_packet(ReadPacketBuffer *buffer) {
   return APIError::OK;
 }
 bool APINoiseFrameHelper::can_write_without_blocking() { return state_ == State::DATA && tx_buf_.empty(); }
-APIError APINoiseFrameHelper::write_packet(uint16_t type, const uint8_t *payload, size_t payload_len) {
+APIError APINoiseFrameHelper::write_protobuf_packets(ProtoWriteBuffer buffer, const PacketInfo *packets,
+                                                     size_t count) {
   int err;
   APIError aerr;
   aerr = state_action_();
@@ -478,45 +480,47 @@ APIError APINoiseFrameHelper::write_packet(uint16_t type, const uint8_t *payload
   if (state_ != State::DATA) {
     return APIError::WOULD_BLOCK;
   }
-
-  size_t padding = 0;
-  size_t msg_len = 4 + payload_len + padding;
-  size_t frame_len = 3 + msg_len + noise_cipherstate_get_mac_length(send_cipher_);
-  auto tmpbuf = std::unique_ptr<uint8_t[]>{new (std::nothrow) uint8_t[frame_len]};
-  if (tmpbuf == nullptr) {
-    HELPER_LOG("Could not allocate for writing packet");
-    return APIError::OUT_OF_MEMORY;
+  if (count == 0) {
+    return APIError::OK;
   }
 
-  tmpbuf[0] = 0x01;  // indicator
-  // tmpbuf[1], tmpbuf[2] to be set later
-  const uint8_t msg_offset = 3;
-  const uint8_t payload_offset = msg_offset + 4;
-  tmpbuf[msg_offset + 0] = (uint8_t) (type >> 8);  // type
-  tmpbuf[msg_offset + 1] = (uint8_t) type;
-  tmpbuf[msg_offset + 2] = (uint8_t) (payload_len >> 8);  // data_len
-  tmpbuf[msg_offset + 3] = (uint8_t) payload_len;
-  // copy data
-  std::copy(payload, payload + payload_len, &tmpbuf[payload_offset]);
-  // fill padding with zeros
-  std::fill(&tmpbuf[payload_offset + payload_len], &tmpbuf[frame_len], 0);
+  uint8_t *buffer_data = buffer.get_buffer()->data();
+  const uint8_t mac_len = noise_cipherstate_get_mac_length(send_cipher_);
+  size_t total_len = 0;
+  for (size_t i = 0; i < count; i++) {
+    const PacketInfo &packet = packets[i];
+    uint8_t *buf = buffer_data + packet.offset;
+    // every message gets its own encrypted frame, the protocol allows only one message per frame
+    size_t msg_len = 4 + packet.payload_size;
+    size_t frame_len = 3 + msg_len + mac_len;
+
+    buf[0] = 0x01;  // indicator
+    // buf[1], buf[2] to be set later
+    const uint8_t msg_offset = 3;
+    buf[msg_offset + 0] = (uint8_t) (packet.message_type >> 8);  // type
+    buf[msg_offset + 1] = (uint8_t) packet.message_type;
+    buf[msg_offset + 2] = (uint8_t) (packet.payload_size >> 8);  // data_len
+    buf[msg_offset + 3] = (uint8_t) packet.payload_size;
+
+    // encrypt in place, the payload already sits right behind the message header
+    NoiseBuffer mbuf;
+    noise_buffer_init(mbuf);
+    noise_buffer_set_inout(mbuf, &buf[msg_offset], msg_len, frame_len - msg_offset);
+    err = noise_cipherstate_encrypt(send_cipher_, &mbuf);
+    if (err != 0) {
+      state_ = State::FAILED;
+      HELPER_LOG("noise_cipherstate_encrypt failed: %s", noise_err_to_str(err).c_str());
+      return APIError::CIPHERSTATE_ENCRYPT_FAILED;
+    }
 
-  NoiseBuffer mbuf;
-  noise_buffer_init(mbuf);
-  noise_buffer_set_inout(mbuf, &tmpbuf[msg_offset], msg_len, frame_len - msg_offset);
-  err = noise_cipherstate_encrypt(send_cipher_, &mbuf);
-  if (err != 0) {
-    state_ = State::FAILED;
-    HELPER_LOG("noise_cipherstate_encrypt failed: %s", noise_err_to_str(err).c_str());
-    return APIError::CIPHERSTATE_ENCRYPT_FAILED;
+    buf[1] = (uint8_t) (mbuf.size >> 8);
+    buf[2] = (uint8_t) mbuf.size;
+    total_len += 3 + mbuf.size;
   }
 
-  size_t total_len = 3 + mbuf.size;
-  tmpbuf[1] = (uint8_t) (mbuf.size >> 8);
-  tmpbuf[2] = (uint8_t) mbuf.size;
-
+  // frames are laid out back to back, so the whole batch is one contiguous write
   struct iovec iov;
-  iov.iov_base = &tmpbuf[0];
+  iov.iov_base = buffer_data + packets[0].offset;
   iov.iov_len = total_len;
 
   // write raw to not have two packets sent if NAGLE disabled
@@ -903,26 +907,38 @@ APIError APIPlaintextFrameHelper::read_packet(ReadPacketBuffer *buffer) {
   return APIError::OK;
 }
 bool APIPlaintextFrameHelper::can_write_without_blocking() { return state_ == State::DATA && tx_buf_.empty(); }
-APIError APIPlaintextFrameHelper::write_packet(uint16_t type, const uint8_t *payload, size_t payload_len) {
+APIError APIPlaintextFrameHelper::write_protobuf_packets(ProtoWriteBuffer buffer, const PacketInfo *packets,
+                                                         size_t count) {
   if (state_ != State::DATA) {
     return APIError::BAD_STATE;
   }
 
-  std::vector<uint8_t> header;
-  header.push_back(0x00);
-  ProtoVarInt(payload_len).encode(header);
-  ProtoVarInt(type).encode(header);
+  uint8_t *buffer_data = buffer.get_buffer()->data();
+  const uint8_t header_padding = this->frame_header_padding();
+  this->tx_iovs_.clear();
+  for (size_t i = 0; i < count; i++) {
+    const PacketInfo &packet = packets[i];
+    const uint8_t size_varint_len = ProtoSize::varint(packet.payload_size);
+    const uint8_t type_varint_len = ProtoSize::varint(static_cast<uint32_t>(packet.message_type));
+    const uint8_t header_len = 1 + size_varint_len + type_varint_len;
+    if (header_len > header_padding) {
+      HELPER_LOG("Packet too big to send: %" PRIu32 " bytes", packet.payload_size);
+      return APIError::BAD_ARG;
+    }
 
-  struct iovec iov[2];
-  iov[0].iov_base = &header[0];
-  iov[0].iov_len = header.size();
-  if (payload_len == 0) {
-    return write_raw_(iov, 1);
+    // the header is right-aligned in the padding so that it ends where the payload starts
+    uint8_t *buf = buffer_data + packet.offset + header_padding - header_len;
+    buf[0] = 0x00;  // indicator
+    ProtoVarInt(packet.payload_size).encode_to_buffer_unchecked(buf + 1, size_varint_len);
+    ProtoVarInt(packet.message_type).encode_to_buffer_unchecked(buf + 1 + size_varint_len, type_varint_len);
+
+    struct iovec iov;
+    iov.iov_base = buf;
+    iov.iov_len = header_len + packet.payload_size;
+    this->tx_iovs_.push_back(iov);
   }
-  iov[1].iov_base = const_cast<uint8_t *>(payload);
-  iov[1].iov_len = payload_len;
 
-  return write_raw_(iov, 2);
+  return write_raw_(this->tx_iovs_.data(), this->tx_iovs_.size());
 }
 APIError APIPlaintextFrameHelper::try_send_tx_buf_() {
   // try send from tx_buf
@@ -11,6 +11,7 @@
 #endif
 
 #include "api_noise_context.h"
+#include "proto.h"
 #include "esphome/components/socket/socket.h"
 
 namespace esphome {
@@ -30,6 +31,14 @@ struct PacketBuffer {
   uint8_t data_len;
 };
 
+/// Location of one encoded message in a buffer passed to APIFrameHelper::write_protobuf_packets().
+struct PacketInfo {
+  /// Start of the frame, the encoded message follows frame_header_padding() bytes later.
+  uint32_t offset;
+  uint32_t payload_size;
+  uint16_t message_type;
+};
+
 enum class APIError : int {
   OK = 0,
   WOULD_BLOCK = 1001,
@@ -65,7 +74,17 @@ class APIFrameHelper {
   virtual APIError loop() = 0;
   virtual APIError read_packet(ReadPacketBuffer *buffer) = 0;
   virtual bool can_write_without_blocking() = 0;
-  virtual APIError write_packet(uint16_t type, const uint8_t *data, size_t len) = 0;
+  /** Send a batch of encoded protobuf messages with a single socket write.
+   *
+   * Every message is laid out as frame_header_padding() free bytes, the encoded message and frame_footer_size() free
+   * bytes, starting at the offset given in its PacketInfo. The frame header and footer are written into that free
+   * space, so the messages themselves are never copied or moved.
+   */
+  virtual APIError write_protobuf_packets(ProtoWriteBuffer buffer, const PacketInfo *packets, size_t count) = 0;
+  /// Number of bytes to leave free in front of an encoded message for the frame header.
+  virtual uint8_t frame_header_padding() = 0;
+  /// Number of bytes to leave free behind an encoded message for the frame footer.
+  virtual uint8_t frame_footer_size() = 0;
   virtual std::string getpeername() = 0;
   virtual int getpeername(struct sockaddr *addr, socklen_t *addrlen) = 0;
   virtual APIError close() = 0;
@@ -84,7 +103,11 @@ class APINoiseFrameHelper : public APIFrameHelper {
   APIError loop() override;
   APIError read_packet(ReadPacketBuffer *buffer) override;
   bool can_write_without_blocking() override;
-  APIError write_packet(uint16_t type, const uint8_t *payload, size_t len) override;
+  APIError write_protobuf_packets(ProtoWriteBuffer buffer, const PacketInfo *packets, size_t count) override;
+  // indicator + encrypted frame size + message type + message size
+  uint8_t frame_header_padding() override { return 7; }
+  // MAC of the ChaChaPoly cipher
+  uint8_t frame_footer_size() override { return 16; }
   std::string getpeername() override { return this->socket_->getpeername(); }
   int getpeername(struct sockaddr *addr, socklen_t *addrlen) override {
     return this->socket_->getpeername(addr, addrlen);
@@ -147,7 +170,10 @@ class APIPlaintextFrameHelper : public APIFrameHelper {
   APIError loop() override;
   APIError read_packet(ReadPacketBuffer *buffer) override;
   bool can_write_without_blocking() override;
-  APIError write_packet(uint16_t type, const uint8_t *payload, size_t len) override;
+  APIError write_protobuf_packets(ProtoWriteBuffer buffer, const PacketInfo *packets, size_t count) override;
+  // indicator + message size varint (up to 3 bytes) + message type varint (up to 2 bytes)
+  uint8_t frame_header_padding() override { return 6; }
+  uint8_t frame_footer_size() override { return 0; }
   std::string getpeername() override { return this->socket_->getpeername(); }
   int getpeername(struct sockaddr *addr, socklen_t *addrlen) override {
     return this->socket_->getpeername(addr, addrlen);
@@ -178,6 +204,8 @@ class APIPlaintextFrameHelper : public APIFrameHelper {
   size_t rx_buf_len_ = 0;
 
   std::vector<uint8_t> tx_buf_;
+  // Reused for every write_protobuf_packets() call, frames are not contiguous because plaintext headers vary in size
+  std::vector<struct iovec> tx_iovs_;
 
   enum class State {
     INITIALIZE = 1,
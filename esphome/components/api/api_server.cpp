@@ -66,14 +66,28 @@ void APIServer::setup() {
     return;
   }
 
+#ifdef USE_HOST
+  App.register_socket_fd(this->socket_->get_fd(), this);
+#endif
+
 #ifdef USE_LOGGER
   if (logger::global_logger != nullptr) {
+#ifdef USE_LOGGER_BINARY
+    logger::global_logger->add_on_binary_log_callback(
+        [this](int level, const char *tag, const char *message, size_t length) {
+          for (auto &c : this->clients_) {
+            if (!c->remove_)
+              c->send_log_message(level, tag, message, length);
+          }
+        });
+#else
     logger::global_logger->add_on_log_callback([this](int level, const char *tag, const char *message) {
       for (auto &c : this->clients_) {
         if (!c->remove_)
           c->send_log_message(level, tag, message);
       }
     });
+#endif
   }
 #endif
 
@@ -121,8 +135,8 @@ void APIServer::loop() {
     client->loop();
   }
 
+  const uint32_t now = millis();
   if (this->reboot_timeout_ != 0) {
-    const uint32_t now = millis();
     if (!this->is_connected()) {
       if (now - this->last_connected_ > this->reboot_timeout_) {
         ESP_LOGE(TAG, "No client connected to API. Rebooting...");
@@ -134,10 +148,23 @@ void APIServer::loop() {
       this->status_clear_warning();
     }
   }
+
+#ifdef USE_HOST
+  if (this->clients_.empty()) {
+    // Nothing to poll without clients, the loop is re-enabled when the listening socket becomes readable.
+    if (this->reboot_timeout_ != 0) {
+      const uint32_t elapsed = now - this->last_connected_;
+      const uint32_t remaining = elapsed < this->reboot_timeout_ ? this->reboot_timeout_ - elapsed : 0;
+      this->set_timeout("reboot_check", remaining + 1, [this]() { this->enable_loop(); });
+    }
+    this->disable_loop();
+  }
+#endif
 }
 void APIServer::dump_config() {
   ESP_LOGCONFIG(TAG, "API Server:");
   ESP_LOGCONFIG(TAG, "  Address: %s:%u", network::get_use_address().c_str(), this->port_);
+  ESP_LOGCONFIG(TAG, "  Batch delay: %ums", this->batch_delay_);
 #ifdef USE_API_NOISE
   ESP_LOGCONFIG(TAG, "  Using noise encryption: YES");
 #else
@@ -388,6 +415,7 @@ bool APIServer::is_connected() const { return !this->clients_.empty(); }
 void APIServer::on_shutdown() {
   for (auto &c : this->clients_) {
     c->send_disconnect_request(DisconnectRequest());
+    c->flush_batch();
   }
   delay(10);
 }
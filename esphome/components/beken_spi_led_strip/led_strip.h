@@ -58,6 +58,7 @@ class BekenSPILEDStripLightOutput : public light::AddressableLight {
 
  protected:
   light::ESPColorView get_view_internal(int32_t index) const override;
+  int32_t get_stride_internal() const override { return this->is_rgbw_ || this->is_wrgb_ ? 4 : 3; }
 
   size_t get_buffer_size_() const { return this->num_leds_ * (this->is_rgbw_ || this->is_wrgb_ ? 4 : 3); }
 
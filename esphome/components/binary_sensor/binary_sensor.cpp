@@ -7,7 +7,7 @@ namespace binary_sensor {
 
 static const char *const TAG = "binary_sensor";
 
-void BinarySensor::add_on_state_callback(std::function<void(bool)> &&callback) {
+void BinarySensor::add_on_state_callback(Delegate<void(bool)> &&callback) {
   this->state_callback_.add(std::move(callback));
 }
 
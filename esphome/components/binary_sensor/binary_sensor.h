@@ -42,7 +42,7 @@ class BinarySensor : public EntityBase, public EntityBase_DeviceClass {
    *
    * @param callback The void(bool) callback.
    */
-  void add_on_state_callback(std::function<void(bool)> &&callback);
+  void add_on_state_callback(Delegate<void(bool)> &&callback);
 
   /** Publish a new state to the front-end.
    *
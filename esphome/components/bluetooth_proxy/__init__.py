@@ -8,6 +8,10 @@ AUTO_LOAD = ["esp32_ble_client", "esp32_ble_tracker"]
 DEPENDENCIES = ["api", "esp32"]
 CODEOWNERS = ["@jesserockz"]
 
+CONF_ADVERTISEMENT_BATCH_SIZE = "advertisement_batch_size"
+CONF_ADVERTISEMENT_FLUSH_INTERVAL = "advertisement_flush_interval"
+CONF_ADVERTISEMENT_WINDOW = "advertisement_window"
+CONF_BLUETOOTH_PROXY_ID = "bluetooth_proxy_id"
 CONF_CACHE_SERVICES = "cache_services"
 CONF_CONNECTIONS = "connections"
 MAX_CONNECTIONS = 3
@@ -56,6 +60,15 @@ CONFIG_SCHEMA = cv.All(
                 cv.ensure_list(CONNECTION_SCHEMA),
                 cv.Length(min=1, max=MAX_CONNECTIONS),
             ),
+            cv.Optional(
+                CONF_ADVERTISEMENT_WINDOW, default="1s"
+            ): cv.positive_time_period_milliseconds,
+            cv.Optional(CONF_ADVERTISEMENT_BATCH_SIZE, default=32): cv.int_range(
+                min=1, max=64
+            ),
+            cv.Optional(
+                CONF_ADVERTISEMENT_FLUSH_INTERVAL, default="100ms"
+            ): cv.positive_time_period_milliseconds,
         }
     )
     .extend(esp32_ble_tracker.ESP_BLE_DEVICE_SCHEMA)
@@ -69,6 +82,11 @@ async def to_code(config):
     await cg.register_component(var, config)
 
     cg.add(var.set_active(config[CONF_ACTIVE]))
+    cg.add(var.set_advertisement_window(config[CONF_ADVERTISEMENT_WINDOW]))
+    cg.add(var.set_advertisement_batch_size(config[CONF_ADVERTISEMENT_BATCH_SIZE]))
+    cg.add(
+        var.set_advertisement_flush_interval(config[CONF_ADVERTISEMENT_FLUSH_INTERVAL])
+    )
     await esp32_ble_tracker.register_ble_device(var, config)
 
     for connection_conf in config.get(CONF_CONNECTIONS, []):
@@ -0,0 +1,95 @@
+#include "advertisement_cache.h"
+
+#include <algorithm>
+
+namespace esphome {
+namespace bluetooth_proxy {
+
+size_t AdvertisementCache::home_slot_(uint64_t address) const {
+  uint64_t hash = address * 0xBF58476D1CE4E5B9ULL;
+  return (hash >> 32) & (this->entries_.size() - 1);
+}
+
+bool AdvertisementCache::should_forward(uint64_t address, uint32_t payload_hash, uint32_t now, uint32_t window) {
+  size_t slot = 0;
+  Entry *expired = nullptr;
+  if (!this->entries_.empty()) {
+    const size_t mask = this->entries_.size() - 1;
+    for (slot = this->home_slot_(address);; slot = (slot + 1) & mask) {
+      Entry &entry = this->entries_[slot];
+      if (entry.address == EMPTY)
+        break;
+      if (entry.address == address) {
+        if (entry.payload_hash == payload_hash && now - entry.time < window)
+          return false;
+        entry.payload_hash = payload_hash;
+        entry.time = now;
+        return true;
+      }
+      if (expired == nullptr && now - entry.time >= window)
+        expired = &entry;
+    }
+  }
+
+  // not in the table, an expired slot earlier on the probe sequence can take it
+  if (expired == nullptr) {
+    // keep the load factor at or below 3/4, so that probing always ends at a free slot
+    if ((this->used_ + 1) * 4 > this->entries_.size() * 3) {
+      // a table full of live entries only gets room once the oldest of them expires
+      if (this->full_ && static_cast<int32_t>(now - this->full_until_) < 0)
+        return true;
+      this->rebuild_(now, window);
+      this->full_ = (this->used_ + 1) * 4 > this->entries_.size() * 3;
+      if (this->full_)
+        return true;
+      const size_t mask = this->entries_.size() - 1;
+      slot = this->home_slot_(address);
+      while (this->entries_[slot].address != EMPTY)
+        slot = (slot + 1) & mask;
+    }
+    expired = &this->entries_[slot];
+    this->used_++;
+  }
+  *expired = Entry{address, payload_hash, now};
+  return true;
+}
+
+void AdvertisementCache::clear() {
+  this->entries_.clear();
+  this->entries_.shrink_to_fit();
+  this->used_ = 0;
+  this->full_ = false;
+}
+
+void AdvertisementCache::rebuild_(uint32_t now, uint32_t window) {
+  size_t live = 0;
+  uint32_t oldest_age = 0;
+  for (auto &entry : this->entries_) {
+    if (entry.address != EMPTY && now - entry.time < window) {
+      live++;
+      oldest_age = std::max(oldest_age, now - entry.time);
+    }
+  }
+  this->full_until_ = now + (window - oldest_age);
+  size_t size = this->entries_.empty() ? 16 : this->entries_.size();
+  while (live * 2 >= size && size < MAX_SLOTS)
+    size *= 2;
+
+  std::vector<Entry> old;
+  old.swap(this->entries_);
+  this->entries_.assign(size, Entry{EMPTY, 0, 0});
+  this->used_ = 0;
+  const size_t mask = size - 1;
+  for (auto &entry : old) {
+    if (entry.address == EMPTY || now - entry.time >= window)
+      continue;
+    size_t slot = this->home_slot_(entry.address);
+    while (this->entries_[slot].address != EMPTY)
+      slot = (slot + 1) & mask;
+    this->entries_[slot] = entry;
+    this->used_++;
+  }
+}
+
+}  // namespace bluetooth_proxy
+}  // namespace esphome
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace esphome {
+namespace bluetooth_proxy {
+
+/** Remembers the last advertisement payload forwarded for each address.
+ *
+ * Open addressing with linear probing on the address. Entries older than the window are reused in place and dropped
+ * whenever the table is rebuilt, so its size follows the number of addresses seen within one window, up to
+ * MAX_SLOTS. Past that, payloads are simply no longer deduplicated.
+ */
+class AdvertisementCache {
+ public:
+  static const size_t MAX_SLOTS = 1024;
+
+  /** Record the payload as forwarded at \p now.
+   *
+   * Returns false if it is the same as the last payload forwarded for \p address, within \p window ms. A device that
+   * alternates between payloads (A, B, A) has all of them forwarded.
+   */
+  bool should_forward(uint64_t address, uint32_t payload_hash, uint32_t now, uint32_t window);
+  void clear();
+  size_t capacity() const { return this->entries_.size(); }
+
+ protected:
+  struct Entry {
+    uint64_t address;
+    uint32_t payload_hash;
+    uint32_t time;
+  };
+  /// Never a 48 bit address, marks free slots.
+  static constexpr uint64_t EMPTY = UINT64_MAX;
+
+  /// Drop expired entries, growing the table if more than half of it is still live.
+  void rebuild_(uint32_t now, uint32_t window);
+  size_t home_slot_(uint64_t address) const;
+
+  std::vector<Entry> entries_;
+  /// Slots that are not free, including expired entries.
+  size_t used_{0};
+  /// Set when the table is at MAX_SLOTS and full of live entries, until the oldest of them expires.
+  bool full_{false};
+  uint32_t full_until_{0};
+};
+
+}  // namespace bluetooth_proxy
+}  // namespace esphome
@@ -1,8 +1,12 @@
 #include "bluetooth_proxy.h"
 
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 #include "esphome/core/macros.h"
 
+#include <cinttypes>
+
 #ifdef USE_ESP32
 
 namespace esphome {
@@ -25,6 +29,19 @@ std::vector<uint64_t> get_128bit_uuid_vec(esp_bt_uuid_t uuid_source) {
 
 BluetoothProxy::BluetoothProxy() { global_bluetooth_proxy = this; }
 
+void BluetoothProxy::setup() {
+#ifdef USE_SENSOR
+  if (this->advertisements_dropped_sensor_ == nullptr && this->advertisements_coalesced_sensor_ == nullptr)
+    return;
+  this->set_interval("counters", 60000, [this]() {
+    if (this->advertisements_dropped_sensor_ != nullptr)
+      this->advertisements_dropped_sensor_->publish_state(this->advertisements_dropped_);
+    if (this->advertisements_coalesced_sensor_ != nullptr)
+      this->advertisements_coalesced_sensor_->publish_state(this->advertisements_coalesced_);
+  });
+#endif
+}
+
 bool BluetoothProxy::parse_device(const esp32_ble_tracker::ESPBTDevice &device) {
   if (!api::global_api_server->is_connected() || this->api_connection_ == nullptr || this->raw_advertisements_)
     return false;
@@ -39,26 +56,66 @@ bool BluetoothProxy::parse_devices(esp_ble_gap_cb_param_t::ble_scan_result_evt_p
   if (!api::global_api_server->is_connected() || this->api_connection_ == nullptr || !this->raw_advertisements_)
     return false;
 
-  api::BluetoothLERawAdvertisementsResponse resp;
+  const uint32_t now = millis();
   for (size_t i = 0; i < count; i++) {
-    auto &result = advertisements[i];
-    api::BluetoothLERawAdvertisement adv;
-    adv.address = esp32_ble::ble_addr_to_uint64(result.bda);
-    adv.rssi = result.rssi;
-    adv.address_type = result.ble_addr_type;
-
-    uint8_t length = result.adv_data_len + result.scan_rsp_len;
-    adv.data.reserve(length);
-    for (uint16_t i = 0; i < length; i++) {
-      adv.data.push_back(result.ble_adv[i]);
+    this->queue_raw_advertisement_(advertisements[i], now);
+  }
+  return true;
+}
+
+void BluetoothProxy::queue_raw_advertisement_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &result,
+                                              uint32_t now) {
+  const uint64_t address = esp32_ble::ble_addr_to_uint64(result.bda);
+  uint8_t length = result.adv_data_len + result.scan_rsp_len;
+  std::string data(reinterpret_cast<const char *>(result.ble_adv), length);
+
+  // Same payload as the latest one of this device still waiting to be sent: only the latest RSSI matters
+  auto &pending = this->pending_.advertisements;
+  for (auto it = pending.rbegin(); it != pending.rend(); ++it) {
+    if (it->address != address)
+      continue;
+    if (it->data == data) {
+      it->rssi = result.rssi;
+      this->advertisements_coalesced_++;
+      return;
     }
+    break;
+  }
 
-    resp.advertisements.push_back(std::move(adv));
+  // Same payload as the last one forwarded for this device, within the window
+  if (this->advertisement_window_ != 0 &&
+      !this->forwarded_.should_forward(address, fnv1_hash(data), now, this->advertisement_window_)) {
+    this->advertisements_dropped_++;
+    return;
   }
-  ESP_LOGV(TAG, "Proxying %d packets", count);
-  this->api_connection_->send_bluetooth_le_raw_advertisements_response(resp);
-  return true;
+
+  if (this->pending_.advertisements.empty())
+    this->pending_since_ = now;
+  api::BluetoothLERawAdvertisement adv;
+  adv.address = address;
+  adv.rssi = result.rssi;
+  adv.address_type = result.ble_addr_type;
+  adv.data = std::move(data);
+  this->pending_.advertisements.push_back(std::move(adv));
+
+  if (this->pending_.advertisements.size() >= this->advertisement_batch_size_)
+    this->flush_raw_advertisements_();
+}
+
+void BluetoothProxy::flush_raw_advertisements_() {
+  if (this->pending_.advertisements.empty())
+    return;
+  ESP_LOGV(TAG, "Proxying %zu packets", this->pending_.advertisements.size());
+  this->api_connection_->send_bluetooth_le_raw_advertisements_response(this->pending_);
+  this->pending_.advertisements.clear();
 }
+
+void BluetoothProxy::reset_raw_advertisements_() {
+  this->pending_.advertisements.clear();
+  // a new subscriber needs to see every device again
+  this->forwarded_.clear();
+}
+
 void BluetoothProxy::send_api_packet_(const esp32_ble_tracker::ESPBTDevice &device) {
   api::BluetoothLEAdvertisementResponse resp;
   resp.address = device.address_uint64();
@@ -87,6 +144,13 @@ void BluetoothProxy::send_api_packet_(const esp32_ble_tracker::ESPBTDevice &devi
 void BluetoothProxy::dump_config() {
   ESP_LOGCONFIG(TAG, "Bluetooth Proxy:");
   ESP_LOGCONFIG(TAG, "  Active: %s", YESNO(this->active_));
+  ESP_LOGCONFIG(TAG, "  Advertisement Window: %" PRIu32 " ms", this->advertisement_window_);
+  ESP_LOGCONFIG(TAG, "  Advertisement Batch Size: %u", this->advertisement_batch_size_);
+  ESP_LOGCONFIG(TAG, "  Advertisement Flush Interval: %" PRIu32 " ms", this->advertisement_flush_interval_);
+#ifdef USE_SENSOR
+  LOG_SENSOR("  ", "Advertisements Dropped", this->advertisements_dropped_sensor_);
+  LOG_SENSOR("  ", "Advertisements Coalesced", this->advertisements_coalesced_sensor_);
+#endif
 }
 
 int BluetoothProxy::get_bluetooth_connections_free() {
@@ -112,6 +176,10 @@ void BluetoothProxy::loop() {
     }
     return;
   }
+  if (!this->pending_.advertisements.empty() &&
+      millis() - this->pending_since_ >= this->advertisement_flush_interval_) {
+    this->flush_raw_advertisements_();
+  }
   for (auto *connection : this->connections_) {
     if (connection->send_service_ == connection->service_count_) {
       connection->send_service_ = DONE_SENDING_SERVICES;
@@ -441,6 +509,7 @@ void BluetoothProxy::subscribe_api_connection(api::APIConnection *api_connection
   }
   this->api_connection_ = api_connection;
   this->raw_advertisements_ = flags & BluetoothProxySubscriptionFlag::SUBSCRIPTION_RAW_ADVERTISEMENTS;
+  this->reset_raw_advertisements_();
   this->parent_->recalculate_advertisement_parser_types();
 }
 
@@ -451,6 +520,7 @@ void BluetoothProxy::unsubscribe_api_connection(api::APIConnection *api_connecti
   }
   this->api_connection_ = nullptr;
   this->raw_advertisements_ = false;
+  this->reset_raw_advertisements_();
   this->parent_->recalculate_advertisement_parser_types();
 }
 
@@ -13,6 +13,11 @@
 #include "esphome/core/component.h"
 #include "esphome/core/defines.h"
 
+#ifdef USE_SENSOR
+#include "esphome/components/sensor/sensor.h"
+#endif
+
+#include "advertisement_cache.h"
 #include "bluetooth_connection.h"
 
 namespace esphome {
@@ -47,6 +52,7 @@ enum BluetoothProxySubscriptionFlag : uint32_t {
 class BluetoothProxy : public esp32_ble_tracker::ESPBTDeviceListener, public Component {
  public:
   BluetoothProxy();
+  void setup() override;
   bool parse_device(const esp32_ble_tracker::ESPBTDevice &device) override;
   bool parse_devices(esp_ble_gap_cb_param_t::ble_scan_result_evt_param *advertisements, size_t count) override;
   void dump_config() override;
@@ -93,6 +99,17 @@ class BluetoothProxy : public esp32_ble_tracker::ESPBTDeviceListener, public Com
   void set_active(bool active) { this->active_ = active; }
   bool has_active() { return this->active_; }
 
+  /// Identical raw advertisements from the same address are forwarded at most once per window (0 disables this).
+  void set_advertisement_window(uint32_t advertisement_window) { this->advertisement_window_ = advertisement_window; }
+  void set_advertisement_batch_size(uint8_t batch_size) { this->advertisement_batch_size_ = batch_size; }
+  void set_advertisement_flush_interval(uint32_t flush_interval) {
+    this->advertisement_flush_interval_ = flush_interval;
+  }
+#ifdef USE_SENSOR
+  void set_advertisements_dropped_sensor(sensor::Sensor *sensor) { this->advertisements_dropped_sensor_ = sensor; }
+  void set_advertisements_coalesced_sensor(sensor::Sensor *sensor) { this->advertisements_coalesced_sensor_ = sensor; }
+#endif
+
   uint32_t get_legacy_version() const {
     if (this->active_) {
       return LEGACY_ACTIVE_CONNECTIONS_VERSION;
@@ -116,6 +133,10 @@ class BluetoothProxy : public esp32_ble_tracker::ESPBTDeviceListener, public Com
 
  protected:
   void send_api_packet_(const esp32_ble_tracker::ESPBTDevice &device);
+  /// Add a raw advertisement to the pending batch, unless it repeats one forwarded within the window.
+  void queue_raw_advertisement_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &result, uint32_t now);
+  void flush_raw_advertisements_();
+  void reset_raw_advertisements_();
 
   BluetoothConnection *get_connection_(uint64_t address, bool reserve);
 
@@ -124,6 +145,19 @@ class BluetoothProxy : public esp32_ble_tracker::ESPBTDeviceListener, public Com
   std::vector<BluetoothConnection *> connections_{};
   api::APIConnection *api_connection_{nullptr};
   bool raw_advertisements_{false};
+
+  AdvertisementCache forwarded_;
+  api::BluetoothLERawAdvertisementsResponse pending_;
+  uint32_t pending_since_{0};
+  uint32_t advertisement_window_{1000};
+  uint32_t advertisement_flush_interval_{100};
+  uint8_t advertisement_batch_size_{32};
+  uint32_t advertisements_dropped_{0};
+  uint32_t advertisements_coalesced_{0};
+#ifdef USE_SENSOR
+  sensor::Sensor *advertisements_dropped_sensor_{nullptr};
+  sensor::Sensor *advertisements_coalesced_sensor_{nullptr};
+#endif
 };
 
 extern BluetoothProxy *global_bluetooth_proxy;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
@@ -0,0 +1,42 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components import sensor
+from esphome.const import (
+    ENTITY_CATEGORY_DIAGNOSTIC,
+    ICON_COUNTER,
+    STATE_CLASS_TOTAL_INCREASING,
+)
+from . import CONF_BLUETOOTH_PROXY_ID, BluetoothProxy
+
+DEPENDENCIES = ["bluetooth_proxy"]
+
+CONF_ADVERTISEMENTS_COALESCED = "advertisements_coalesced"
+CONF_ADVERTISEMENTS_DROPPED = "advertisements_dropped"
+
+CONFIG_SCHEMA = {
+    cv.GenerateID(CONF_BLUETOOTH_PROXY_ID): cv.use_id(BluetoothProxy),
+    cv.Optional(CONF_ADVERTISEMENTS_DROPPED): sensor.sensor_schema(
+        icon=ICON_COUNTER,
+        accuracy_decimals=0,
+        state_class=STATE_CLASS_TOTAL_INCREASING,
+        entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+    ),
+    cv.Optional(CONF_ADVERTISEMENTS_COALESCED): sensor.sensor_schema(
+        icon=ICON_COUNTER,
+        accuracy_decimals=0,
+        state_class=STATE_CLASS_TOTAL_INCREASING,
+        entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+    ),
+}
+
+
+async def to_code(config):
+    bluetooth_proxy = await cg.get_variable(config[CONF_BLUETOOTH_PROXY_ID])
+
+    if dropped_conf := config.get(CONF_ADVERTISEMENTS_DROPPED):
+        sens = await sensor.new_sensor(dropped_conf)
+        cg.add(bluetooth_proxy.set_advertisements_dropped_sensor(sens))
+
+    if coalesced_conf := config.get(CONF_ADVERTISEMENTS_COALESCED):
+        sens = await sensor.new_sensor(coalesced_conf)
+        cg.add(bluetooth_proxy.set_advertisements_coalesced_sensor(sens))
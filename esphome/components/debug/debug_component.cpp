@@ -1,6 +1,7 @@
 #include "debug_component.h"
 
 #include <algorithm>
+#include "esphome/core/application.h"
 #include "esphome/core/log.h"
 #include "esphome/core/hal.h"
 #include "esphome/core/helpers.h"
@@ -21,6 +22,9 @@ void DebugComponent::dump_config() {
   ESP_LOGCONFIG(TAG, "Debug component:");
 #ifdef USE_TEXT_SENSOR
   LOG_TEXT_SENSOR("  ", "Device info", this->device_info_);
+#ifdef USE_PROFILER
+  LOG_TEXT_SENSOR("  ", "Profiler", this->profiler_);
+#endif  // USE_PROFILER
 #endif  // USE_TEXT_SENSOR
 #ifdef USE_SENSOR
   LOG_SENSOR("  ", "Free space on heap", this->free_sensor_);
@@ -84,9 +88,40 @@ void DebugComponent::update() {
   }
 
 #endif  // USE_SENSOR
+
+#if defined(USE_TEXT_SENSOR) && defined(USE_PROFILER)
+  if (this->profiler_ != nullptr) {
+    this->profiler_->publish_state(this->get_profiler_summary_());
+  }
+#endif  // defined(USE_TEXT_SENSOR) && defined(USE_PROFILER)
   update_platform_();
 }
 
+#ifdef USE_PROFILER
+std::string DebugComponent::get_profiler_summary_() {
+  // Entries with the most total time spent first, formatted as "source kind avg/p99/max us"
+  std::vector<const ProfilerEntry *> entries;
+  for (const auto &entry : App.profiler.get_entries()) {
+    if (entry.used)
+      entries.push_back(&entry);
+  }
+  std::sort(entries.begin(), entries.end(),
+            [](const ProfilerEntry *a, const ProfilerEntry *b) { return a->total_us > b->total_us; });
+
+  std::string summary;
+  char buf[96];
+  for (const auto *entry : entries) {
+    const char *source = entry->component == nullptr ? "<unknown>" : entry->component->get_component_source();
+    snprintf(buf, sizeof(buf), "%s%s %s %" PRIu32 "/%" PRIu32 "/%" PRIu32 "us", summary.empty() ? "" : ", ", source,
+             entry->get_kind_str(), entry->get_avg_us(), entry->get_percentile_us(0.99f), entry->max_us);
+    if (summary.size() + strlen(buf) > 255)
+      break;
+    summary += buf;
+  }
+  return summary;
+}
+#endif  // USE_PROFILER
+
 float DebugComponent::get_setup_priority() const { return setup_priority::LATE; }
 
 }  // namespace debug
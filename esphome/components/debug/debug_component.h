@@ -25,6 +25,9 @@ class DebugComponent : public PollingComponent {
 #ifdef USE_TEXT_SENSOR
   void set_device_info_sensor(text_sensor::TextSensor *device_info) { device_info_ = device_info; }
   void set_reset_reason_sensor(text_sensor::TextSensor *reset_reason) { reset_reason_ = reset_reason; }
+#ifdef USE_PROFILER
+  void set_profiler_sensor(text_sensor::TextSensor *profiler) { profiler_ = profiler; }
+#endif  // USE_PROFILER
 #endif  // USE_TEXT_SENSOR
 #ifdef USE_SENSOR
   void set_free_sensor(sensor::Sensor *free_sensor) { free_sensor_ = free_sensor; }
@@ -58,8 +61,15 @@ class DebugComponent : public PollingComponent {
 #ifdef USE_TEXT_SENSOR
   text_sensor::TextSensor *device_info_{nullptr};
   text_sensor::TextSensor *reset_reason_{nullptr};
+#ifdef USE_PROFILER
+  text_sensor::TextSensor *profiler_{nullptr};
+#endif  // USE_PROFILER
 #endif  // USE_TEXT_SENSOR
 
+#ifdef USE_PROFILER
+  std::string get_profiler_summary_();
+#endif  // USE_PROFILER
+
   std::string get_reset_reason_();
   uint32_t get_free_heap_();
   void get_device_info_(std::string &device_info);
@@ -6,9 +6,10 @@ from esphome.const import (
     ENTITY_CATEGORY_DIAGNOSTIC,
     ICON_CHIP,
     ICON_RESTART,
+    ICON_TIMER,
 )
 
-from . import CONF_DEBUG_ID, DebugComponent
+from . import CONF_DEBUG_ID, CONF_PROFILER, DebugComponent
 
 DEPENDENCIES = ["debug"]
 
@@ -25,6 +26,10 @@ CONFIG_SCHEMA = cv.Schema(
             icon=ICON_RESTART,
             entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
         ),
+        cv.Optional(CONF_PROFILER): text_sensor.text_sensor_schema(
+            icon=ICON_TIMER,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
     }
 )
 
@@ -38,3 +43,7 @@ async def to_code(config):
     if CONF_RESET_REASON in config:
         sens = await text_sensor.new_text_sensor(config[CONF_RESET_REASON])
         cg.add(debug_component.set_reset_reason_sensor(sens))
+    if CONF_PROFILER in config:
+        cg.add_define("USE_PROFILER")
+        sens = await text_sensor.new_text_sensor(config[CONF_PROFILER])
+        cg.add(debug_component.set_profiler_sensor(sens))
@@ -1,5 +1,6 @@
 #include "display_buffer.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "esphome/core/application.h"
@@ -68,5 +69,99 @@ void HOT DisplayBuffer::draw_pixel_at(int x, int y, Color color) {
   App.feed_wdt();
 }
 
+static int32_t rect_area(const Rect &rect) { return int32_t(rect.w) * rect.h; }
+
+static Rect rect_union(const Rect &a, const Rect &b) {
+  const int16_t x = std::min(a.x, b.x);
+  const int16_t y = std::min(a.y, b.y);
+  return Rect(x, y, std::max(a.x2(), b.x2()) - x, std::max(a.y2(), b.y2()) - y);
+}
+
+static bool rects_overlap(const Rect &a, const Rect &b) {
+  return a.x < b.x2() && b.x < a.x2() && a.y < b.y2() && b.y < a.y2();
+}
+
+void HOT DisplayBuffer::mark_dirty_(int x1, int y1, int x2, int y2) {
+  const Rect rect(x1, y1, x2 - x1 + 1, y2 - y1 + 1);
+
+  // extend the region that wastes the fewest unchanged pixels when merged with this one
+  int best = -1;
+  int32_t best_waste = INT32_MAX;
+  bool overlaps = false;
+  for (uint8_t i = 0; i < this->dirty_count_; i++) {
+    const Rect &dirty = this->dirty_rects_[i];
+    const int32_t waste = rect_area(rect_union(dirty, rect)) - rect_area(dirty) - rect_area(rect);
+    if (waste < best_waste) {
+      best = i;
+      best_waste = waste;
+    }
+    overlaps |= rects_overlap(dirty, rect);
+  }
+  // a change that overlaps a region is always merged, however much it wastes, so that no pixel is transferred twice
+  if (best < 0 || (!overlaps && best_waste > DIRTY_MERGE_SLACK && this->dirty_count_ < MAX_DIRTY_RECTS)) {
+    this->last_dirty_ = this->dirty_count_;
+    this->dirty_rects_[this->dirty_count_++] = rect;
+    return;
+  }
+
+  Rect merged = rect_union(this->dirty_rects_[best], rect);
+  // the grown region may now overlap others, fold them in as well
+  for (uint8_t i = 0; i < this->dirty_count_;) {
+    if (i != best && rects_overlap(merged, this->dirty_rects_[i])) {
+      merged = rect_union(merged, this->dirty_rects_[i]);
+      this->dirty_rects_[i] = this->dirty_rects_[--this->dirty_count_];
+      if (best == this->dirty_count_)
+        best = i;
+      i = 0;
+      continue;
+    }
+    i++;
+  }
+  this->dirty_rects_[best] = merged;
+  this->last_dirty_ = best;
+}
+
+void DisplayBuffer::mark_all_dirty_() {
+  this->dirty_rects_[0] = Rect(0, 0, this->get_width_internal(), this->get_height_internal());
+  this->dirty_count_ = 1;
+  this->last_dirty_ = 0;
+}
+
+void HOT DisplayBuffer::horizontal_line(int x, int y, int width, Color color) {
+  Rect clipping = this->get_clipping();
+  if (clipping.is_set()) {
+    // same bounds as Rect::inside(), the right and bottom edges are included
+    if (y < clipping.y || y > clipping.y2())
+      return;
+    const int x2 = std::min(x + width, clipping.x2() + 1);
+    x = std::max<int>(x, clipping.x);
+    width = x2 - x;
+  }
+  if (width <= 0)
+    return;
+
+  const int width_internal = this->get_width_internal();
+  const int height_internal = this->get_height_internal();
+  switch (this->rotation_) {
+    case DISPLAY_ROTATION_0_DEGREES:
+      for (int i = x; i < x + width; i++)
+        this->draw_absolute_pixel_internal(i, y, color);
+      break;
+    case DISPLAY_ROTATION_90_DEGREES:
+      for (int i = x; i < x + width; i++)
+        this->draw_absolute_pixel_internal(width_internal - y - 1, i, color);
+      break;
+    case DISPLAY_ROTATION_180_DEGREES:
+      for (int i = x; i < x + width; i++)
+        this->draw_absolute_pixel_internal(width_internal - i - 1, height_internal - y - 1, color);
+      break;
+    case DISPLAY_ROTATION_270_DEGREES:
+      for (int i = x; i < x + width; i++)
+        this->draw_absolute_pixel_internal(y, height_internal - i - 1, color);
+      break;
+  }
+  App.feed_wdt();
+}
+
 }  // namespace display
 }  // namespace esphome
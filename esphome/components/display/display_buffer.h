@@ -21,13 +21,42 @@ class DisplayBuffer : public Display {
 
   /// Set a single pixel at the specified coordinates to the given color.
   void draw_pixel_at(int x, int y, Color color) override;
+  /// Draw a horizontal line, clipping and rotating the whole line at once.
+  void horizontal_line(int x, int y, int width, Color color = COLOR_ON) override;
 
  protected:
+  /// Maximum number of separate regions tracked by mark_dirty_(), further changes are merged into one of them.
+  static constexpr uint8_t MAX_DIRTY_RECTS = 8;
+  /// Neighbouring changes are merged if that adds at most this many unchanged pixels to the transfer.
+  static constexpr int32_t DIRTY_MERGE_SLACK = 256;
+
   virtual void draw_absolute_pixel_internal(int x, int y, Color color) = 0;
 
   void init_internal_(uint32_t buffer_length);
 
+  /** Record that the buffer changed in [x1, x2] x [y1, y2] (absolute coordinates, inclusive).
+   *
+   * Drivers call this when they modify their buffer, and transfer only the regions returned by get_dirty_rects_()
+   * to the display. The regions never overlap.
+   */
+  void mark_dirty_(int x1, int y1, int x2, int y2);
+  inline void mark_dirty_(int x, int y) {
+    // consecutive pixels usually land in the region that was extended last
+    const Rect &last = this->dirty_rects_[this->last_dirty_];
+    if (this->last_dirty_ < this->dirty_count_ && x >= last.x && x < last.x2() && y >= last.y && y < last.y2())
+      return;
+    this->mark_dirty_(x, y, x, y);
+  }
+  void mark_all_dirty_();
+  void clear_dirty_() { this->dirty_count_ = 0; }
+  /// Regions changed since the last clear_dirty_(), in absolute coordinates. x2() and y2() are exclusive.
+  const Rect *get_dirty_rects_() const { return this->dirty_rects_; }
+  uint8_t get_dirty_count_() const { return this->dirty_count_; }
+
   uint8_t *buffer_{nullptr};
+  Rect dirty_rects_[MAX_DIRTY_RECTS];
+  uint8_t dirty_count_{0};
+  uint8_t last_dirty_{0};
 };
 
 }  // namespace display
@@ -2,11 +2,21 @@ import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome.components.light.types import AddressableLightEffect
 from esphome.components.light.effects import register_addressable_effect
+from esphome.components.light.streaming import (
+    CONF_STREAMING,
+    STREAMING_SCHEMA,
+    setup_streaming,
+    streaming_auto_load,
+)
 from esphome.const import CONF_ID, CONF_NAME, CONF_METHOD, CONF_CHANNELS
 
-AUTO_LOAD = ["socket"]
 DEPENDENCIES = ["network"]
 
+
+def AUTO_LOAD():
+    return ["socket", *streaming_auto_load("e131")]
+
+
 e131_ns = cg.esphome_ns.namespace("e131")
 E131AddressableLightEffect = e131_ns.class_(
     "E131AddressableLightEffect", AddressableLightEffect
@@ -46,6 +56,7 @@ async def to_code(config):
         cv.GenerateID(CONF_E131_ID): cv.use_id(E131Component),
         cv.Required(CONF_UNIVERSE): cv.int_range(min=1, max=512),
         cv.Optional(CONF_CHANNELS, default="RGB"): cv.one_of(*CHANNELS, upper=True),
+        cv.Optional(CONF_STREAMING): STREAMING_SCHEMA,
     },
 )
 async def e131_light_effect_to_code(config, effect_id):
@@ -55,4 +66,5 @@ async def e131_light_effect_to_code(config, effect_id):
     cg.add(effect.set_first_universe(config[CONF_UNIVERSE]))
     cg.add(effect.set_channels(CHANNELS[config[CONF_CHANNELS]]))
     cg.add(effect.set_e131(parent))
+    await setup_streaming(effect, config)
     return effect
@@ -5,7 +5,6 @@
 #include "esphome/core/component.h"
 
 #include <cinttypes>
-#include <map>
 #include <memory>
 #include <set>
 #include <vector>
@@ -18,6 +17,8 @@ class E131AddressableLightEffect;
 enum E131ListenMethod { E131_MULTICAST, E131_UNICAST };
 
 const int E131_MAX_PROPERTY_VALUES_COUNT = 513;
+/// Upper bound of packets handled per loop() iteration, so that a flood of packets can't block the loop.
+const int E131_MAX_PACKETS_PER_LOOP = 32;
 
 struct E131Packet {
   uint16_t count;
@@ -39,7 +40,12 @@ class E131Component : public esphome::Component {
   void set_method(E131ListenMethod listen_method) { this->listen_method_ = listen_method; }
 
  protected:
-  bool packet_(const std::vector<uint8_t> &data, int &universe, E131Packet &packet);
+  struct UniverseConsumers {
+    uint16_t universe;
+    uint16_t consumers;
+  };
+
+  bool packet_(const uint8_t *data, size_t len, int &universe, E131Packet &packet);
   bool process_(int universe, const E131Packet &packet);
   bool join_igmp_groups_();
   void join_(int universe);
@@ -48,8 +54,8 @@ class E131Component : public esphome::Component {
   E131ListenMethod listen_method_{E131_MULTICAST};
   std::unique_ptr<socket::Socket> socket_;
   std::set<E131AddressableLightEffect *> light_effects_;
-  std::map<int, int> universe_consumers_;
-  std::map<int, E131Packet> universe_packets_;
+  /// Flat table of the universes effects listen to, there are only a few so a linear search is fastest.
+  std::vector<UniverseConsumers> universe_consumers_;
 };
 
 }  // namespace e131
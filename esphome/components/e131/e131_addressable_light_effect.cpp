@@ -28,6 +28,11 @@ int E131AddressableLightEffect::get_universe_count() const {
 void E131AddressableLightEffect::start() {
   AddressableLightEffect::start();
 
+  if (this->stream_ != nullptr) {
+    this->stream_->start(this->get_addressable_()->size());
+    this->last_received_universe_ = 0;
+  }
+
   if (this->e131_) {
     this->e131_->add_effect(this);
   }
@@ -37,12 +42,18 @@ void E131AddressableLightEffect::stop() {
   if (this->e131_) {
     this->e131_->remove_effect(this);
   }
+  if (this->stream_ != nullptr) {
+    this->stream_->stop();
+  }
 
   AddressableLightEffect::stop();
 }
 
 void E131AddressableLightEffect::apply(light::AddressableLight &it, const Color &current_color) {
-  // ignore, it is run by `E131Component::update()`
+  // packets are applied by `E131Component::loop()`, only buffered frames are played out here
+  if (this->is_streaming_()) {
+    this->stream_->apply(it);
+  }
 }
 
 bool E131AddressableLightEffect::process_(int universe, const E131Packet &packet) {
@@ -61,31 +72,50 @@ bool E131AddressableLightEffect::process_(int universe, const E131Packet &packet
   ESP_LOGV(TAG, "Applying data for '%s' on %d universe, for %" PRId32 "-%d.", get_name().c_str(), universe,
            output_offset, output_end);
 
+  // when streaming, the universes are collected into a frame which is played out by the jitter buffer
+  Color *frame = nullptr;
+  if (this->is_streaming_()) {
+    // a universe that was already received starts the next frame, even if packets of the current one got lost
+    if (universe <= this->last_received_universe_)
+      this->stream_->commit();
+    this->last_received_universe_ = universe;
+    frame = this->stream_->frame();
+  }
+  auto set = [it, frame](int32_t led, const Color &color) {
+    if (frame != nullptr) {
+      frame[led] = color;
+    } else {
+      (*it)[led] = color;
+    }
+  };
+
   switch (channels_) {
     case E131_MONO:
       for (; output_offset < output_end; output_offset++, input_data++) {
-        auto output = (*it)[output_offset];
-        output.set(Color(input_data[0], input_data[0], input_data[0], input_data[0]));
+        set(output_offset, Color(input_data[0], input_data[0], input_data[0], input_data[0]));
       }
       break;
 
     case E131_RGB:
       for (; output_offset < output_end; output_offset++, input_data += 3) {
-        auto output = (*it)[output_offset];
-        output.set(
+        set(output_offset,
             Color(input_data[0], input_data[1], input_data[2], (input_data[0] + input_data[1] + input_data[2]) / 3));
       }
       break;
 
     case E131_RGBW:
       for (; output_offset < output_end; output_offset++, input_data += 4) {
-        auto output = (*it)[output_offset];
-        output.set(Color(input_data[0], input_data[1], input_data[2], input_data[3]));
+        set(output_offset, Color(input_data[0], input_data[1], input_data[2], input_data[3]));
       }
       break;
   }
 
-  it->schedule_show();
+  if (frame == nullptr) {
+    it->schedule_show();
+  } else if (universe == get_last_universe()) {
+    this->stream_->commit();
+    this->last_received_universe_ = 0;
+  }
   return true;
 }
 
@@ -2,6 +2,7 @@
 
 #include "esphome/core/component.h"
 #include "esphome/components/light/addressable_light_effect.h"
+#include "esphome/components/light/addressable_light_stream.h"
 #ifdef USE_NETWORK
 namespace esphome {
 namespace e131 {
@@ -28,14 +29,18 @@ class E131AddressableLightEffect : public light::AddressableLightEffect {
   void set_first_universe(int universe) { this->first_universe_ = universe; }
   void set_channels(E131LightChannels channels) { this->channels_ = channels; }
   void set_e131(E131Component *e131) { this->e131_ = e131; }
+  void set_stream(light::AddressableLightStream *stream) { this->stream_ = stream; }
 
  protected:
   bool process_(int universe, const E131Packet &packet);
+  bool is_streaming_() const { return this->stream_ != nullptr && this->stream_->is_started(); }
 
   int first_universe_{0};
   int last_universe_{0};
   E131LightChannels channels_{E131_RGB};
   E131Component *e131_{nullptr};
+  light::AddressableLightStream *stream_{nullptr};
+  int last_received_universe_{0};
 
   friend class E131Component;
 };
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cstring>
 #include "e131.h"
 #ifdef USE_NETWORK
@@ -65,16 +66,16 @@ bool E131Component::join_igmp_groups_() {
     return false;
 
   for (auto universe : universe_consumers_) {
-    if (!universe.second)
+    if (!universe.consumers)
       continue;
 
     ip4_addr_t multicast_addr =
-        network::IPAddress(239, 255, ((universe.first >> 8) & 0xff), ((universe.first >> 0) & 0xff));
+        network::IPAddress(239, 255, ((universe.universe >> 8) & 0xff), ((universe.universe >> 0) & 0xff));
 
     auto err = igmp_joingroup(IP4_ADDR_ANY4, &multicast_addr);
 
     if (err) {
-      ESP_LOGW(TAG, "IGMP join for %d universe of E1.31 failed. Multicast might not work.", universe.first);
+      ESP_LOGW(TAG, "IGMP join for %d universe of E1.31 failed. Multicast might not work.", universe.universe);
     }
   }
 
@@ -82,8 +83,11 @@ bool E131Component::join_igmp_groups_() {
 }
 
 void E131Component::join_(int universe) {
-  // store only latest received packet for the given universe
-  auto consumers = ++universe_consumers_[universe];
+  auto it = std::find_if(universe_consumers_.begin(), universe_consumers_.end(),
+                         [universe](const UniverseConsumers &entry) { return entry.universe == universe; });
+  if (it == universe_consumers_.end())
+    it = universe_consumers_.insert(it, UniverseConsumers{static_cast<uint16_t>(universe), 0});
+  auto consumers = ++it->consumers;
 
   if (consumers > 1) {
     return;  // we already joined before
@@ -95,7 +99,11 @@ void E131Component::join_(int universe) {
 }
 
 void E131Component::leave_(int universe) {
-  auto consumers = --universe_consumers_[universe];
+  auto it = std::find_if(universe_consumers_.begin(), universe_consumers_.end(),
+                         [universe](const UniverseConsumers &entry) { return entry.universe == universe; });
+  if (it == universe_consumers_.end())
+    return;
+  auto consumers = --it->consumers;
 
   if (consumers > 0) {
     return;  // we have other consumers of the given universe
@@ -110,11 +118,11 @@ void E131Component::leave_(int universe) {
   ESP_LOGD(TAG, "Left %d universe for E1.31.", universe);
 }
 
-bool E131Component::packet_(const std::vector<uint8_t> &data, int &universe, E131Packet &packet) {
-  if (data.size() < E131_MIN_PACKET_SIZE)
+bool E131Component::packet_(const uint8_t *data, size_t len, int &universe, E131Packet &packet) {
+  if (len < E131_MIN_PACKET_SIZE)
     return false;
 
-  auto *sbuff = reinterpret_cast<const E131RawPacket *>(&data[0]);
+  auto *sbuff = reinterpret_cast<const E131RawPacket *>(data);
 
   if (memcmp(sbuff->acn_id, ACN_ID, sizeof(sbuff->acn_id)) != 0)
     return false;
@@ -1,6 +1,7 @@
 #ifdef USE_ESP32
 
 #include "esphome/core/preferences.h"
+#include "esphome/core/preference_store.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 #include <nvs_flash.h>
@@ -14,182 +15,208 @@ namespace esp32 {
 
 static const char *const TAG = "esp32.preferences";
 
-struct NVSData {
-  std::string key;
-  std::vector<uint8_t> data;
-};
-
-static std::vector<NVSData> s_pending_save;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+/// NVS already spreads writes over its sectors, two pages are enough to always keep a complete copy.
+static const uint8_t PAGE_COUNT = 2;
+/// Changed preferences are appended to a page until it reaches this size.
+static const size_t PAGE_SIZE = 2048;
 
-class ESP32PreferenceBackend : public ESPPreferenceBackend {
+/** Each page is a blob in the NVS namespace, next to the per-preference blobs of earlier versions.
+ *
+ * NVS can't append to a blob, so every chunk appended to page N is a blob of its own ("pageN.1", "pageN.2", ...).
+ */
+class NVSPreferencePages : public PreferenceStorePages {
  public:
-  std::string key;
-  uint32_t nvs_handle;
-  bool save(const uint8_t *data, size_t len) override {
-    // try find in pending saves and update that
-    for (auto &obj : s_pending_save) {
-      if (obj.key == key) {
-        obj.data.assign(data, data + len);
-        return true;
+  uint32_t nvs_handle{0};
+
+  bool read_page(uint8_t page, std::vector<uint8_t> &data) override {
+    char key[16];
+    data.clear();
+    this->appended_[page] = 0;
+    for (uint16_t segment = 0;; segment++) {
+      page_key(page, segment, key);
+      size_t len;
+      esp_err_t err = nvs_get_blob(nvs_handle, key, nullptr, &len);
+      if (err != 0) {
+        // the first missing appended chunk ends the page
+        if (segment == 0)
+          ESP_LOGV(TAG, "nvs_get_blob('%s'): %s - the page might not be written yet", key, esp_err_to_name(err));
+        return segment != 0;
       }
+      const size_t start = data.size();
+      data.resize(start + len);
+      err = nvs_get_blob(nvs_handle, key, &data[start], &len);
+      if (err != 0) {
+        ESP_LOGV(TAG, "nvs_get_blob('%s') failed: %s", key, esp_err_to_name(err));
+        data.resize(start);
+        return segment != 0;
+      }
+      this->appended_[page] = segment;
     }
-    NVSData save{};
-    save.key = key;
-    save.data.assign(data, data + len);
-    s_pending_save.emplace_back(save);
-    ESP_LOGVV(TAG, "s_pending_save: key: %s, len: %d", key.c_str(), len);
-    return true;
   }
-  bool load(uint8_t *data, size_t len) override {
-    // try find in pending saves and load from that
-    for (auto &obj : s_pending_save) {
-      if (obj.key == key) {
-        if (obj.data.size() != len) {
-          // size mismatch
-          return false;
-        }
-        memcpy(data, obj.data.data(), len);
-        return true;
-      }
+  bool write_page(uint8_t page, const uint8_t *data, size_t len) override {
+    char key[16];
+    // drop the chunks appended to the previous contents first, they would follow the new one otherwise
+    for (uint16_t segment = 1; segment <= this->appended_[page]; segment++) {
+      page_key(page, segment, key);
+      nvs_erase_key(nvs_handle, key);
     }
-
-    size_t actual_len;
-    esp_err_t err = nvs_get_blob(nvs_handle, key.c_str(), nullptr, &actual_len);
-    if (err != 0) {
-      ESP_LOGV(TAG, "nvs_get_blob('%s'): %s - the key might not be set yet", key.c_str(), esp_err_to_name(err));
+    this->appended_[page] = 0;
+    page_key(page, 0, key);
+    return this->write_blob_(key, data, len);
+  }
+  bool append_page(uint8_t page, const uint8_t *data, size_t len) override {
+    char key[16];
+    page_key(page, this->appended_[page] + 1, key);
+    if (!this->write_blob_(key, data, len))
       return false;
+    this->appended_[page]++;
+    return true;
+  }
+  bool erase() override {
+    nvs_flash_deinit();
+    nvs_flash_erase();
+    // Make the handle invalid to prevent any saves until restart
+    nvs_handle = 0;
+    return true;
+  }
+
+ protected:
+  static void page_key(uint8_t page, uint16_t segment, char *key) {
+    if (segment == 0) {
+      snprintf(key, 16, "page%u", page);
+    } else {
+      snprintf(key, 16, "page%u.%u", page, segment);
     }
-    if (actual_len != len) {
-      ESP_LOGVV(TAG, "NVS length does not match (%u!=%u)", actual_len, len);
+  }
+  bool write_blob_(const char *key, const uint8_t *data, size_t len) {
+    esp_err_t err = nvs_set_blob(nvs_handle, key, data, len);
+    if (err != 0) {
+      ESP_LOGV(TAG, "nvs_set_blob('%s', len=%u) failed: %s", key, len, esp_err_to_name(err));
       return false;
     }
-    err = nvs_get_blob(nvs_handle, key.c_str(), data, &len);
+    // note: commit on esp-idf currently is a no-op, nvs_set_blob always writes
+    err = nvs_commit(nvs_handle);
     if (err != 0) {
-      ESP_LOGV(TAG, "nvs_get_blob('%s') failed: %s", key.c_str(), esp_err_to_name(err));
+      ESP_LOGV(TAG, "nvs_commit() failed: %s", esp_err_to_name(err));
       return false;
-    } else {
-      ESP_LOGVV(TAG, "nvs_get_blob: key: %s, len: %d", key.c_str(), len);
     }
     return true;
   }
+
+  /// Number of chunks appended to each page, the blobs "pageN.1" up to this.
+  uint16_t appended_[PAGE_COUNT]{};
+};
+
+class ESP32Preferences;
+
+class ESP32PreferenceBackend : public ESPPreferenceBackend {
+ public:
+  ESP32Preferences *prefs;
+  int slot;
+  bool save(const uint8_t *data, size_t len) override;
+  bool load(uint8_t *data, size_t len) override;
 };
 
 class ESP32Preferences : public ESPPreferences {
  public:
-  uint32_t nvs_handle;
+  NVSPreferencePages pages;
+  PreferenceStore store{&pages, PAGE_COUNT, PAGE_SIZE};
+  /// Keys of preferences loaded from their own blob, removed once they are in a page.
+  std::vector<uint32_t> legacy_keys;
 
   void open() {
     nvs_flash_init();
-    esp_err_t err = nvs_open("esphome", NVS_READWRITE, &nvs_handle);
-    if (err == 0)
-      return;
-
-    ESP_LOGW(TAG, "nvs_open failed: %s - erasing NVS...", esp_err_to_name(err));
-    nvs_flash_deinit();
-    nvs_flash_erase();
-    nvs_flash_init();
-
-    err = nvs_open("esphome", NVS_READWRITE, &nvs_handle);
+    esp_err_t err = nvs_open("esphome", NVS_READWRITE, &pages.nvs_handle);
     if (err != 0) {
-      nvs_handle = 0;
+      ESP_LOGW(TAG, "nvs_open failed: %s - erasing NVS...", esp_err_to_name(err));
+      nvs_flash_deinit();
+      nvs_flash_erase();
+      nvs_flash_init();
+
+      err = nvs_open("esphome", NVS_READWRITE, &pages.nvs_handle);
+      if (err != 0) {
+        pages.nvs_handle = 0;
+      }
     }
+    store.open();
   }
   ESPPreferenceObject make_preference(size_t length, uint32_t type, bool in_flash) override {
     return make_preference(length, type);
   }
   ESPPreferenceObject make_preference(size_t length, uint32_t type) override {
+    int slot = store.add(type, length);
+    if (slot < 0) {
+      ESP_LOGE(TAG, "No room for preference %" PRIu32 " (%u bytes)", type, length);
+      return {};
+    }
     auto *pref = new ESP32PreferenceBackend();  // NOLINT(cppcoreguidelines-owning-memory)
-    pref->nvs_handle = nvs_handle;
-
-    uint32_t keyval = type;
-    pref->key = str_sprintf("%" PRIu32, keyval);
-
+    pref->prefs = this;
+    pref->slot = slot;
     return ESPPreferenceObject(pref);
   }
 
-  bool sync() override {
-    if (s_pending_save.empty())
-      return true;
-
-    ESP_LOGD(TAG, "Saving %d preferences to flash...", s_pending_save.size());
-    // goal try write all pending saves even if one fails
-    int cached = 0, written = 0, failed = 0;
-    esp_err_t last_err = ESP_OK;
-    std::string last_key{};
-
-    // go through vector from back to front (makes erase easier/more efficient)
-    for (ssize_t i = s_pending_save.size() - 1; i >= 0; i--) {
-      const auto &save = s_pending_save[i];
-      ESP_LOGVV(TAG, "Checking if NVS data %s has changed", save.key.c_str());
-      if (is_changed(nvs_handle, save)) {
-        esp_err_t err = nvs_set_blob(nvs_handle, save.key.c_str(), save.data.data(), save.data.size());
-        ESP_LOGV(TAG, "sync: key: %s, len: %d", save.key.c_str(), save.data.size());
-        if (err != 0) {
-          ESP_LOGV(TAG, "nvs_set_blob('%s', len=%u) failed: %s", save.key.c_str(), save.data.size(),
-                   esp_err_to_name(err));
-          failed++;
-          last_err = err;
-          last_key = save.key;
-          continue;
-        }
-        written++;
-      } else {
-        ESP_LOGV(TAG, "NVS data not changed skipping %s  len=%u", save.key.c_str(), save.data.size());
-        cached++;
-      }
-      s_pending_save.erase(s_pending_save.begin() + i);
+  /// Load a preference stored by earlier versions, with one blob per preference.
+  bool load_legacy(uint32_t type, uint8_t *data, size_t len) {
+    std::string key = str_sprintf("%" PRIu32, type);
+    size_t actual_len;
+    esp_err_t err = nvs_get_blob(pages.nvs_handle, key.c_str(), nullptr, &actual_len);
+    if (err != 0) {
+      ESP_LOGV(TAG, "nvs_get_blob('%s'): %s - the key might not be set yet", key.c_str(), esp_err_to_name(err));
+      return false;
     }
-    ESP_LOGD(TAG, "Saving %d preferences to flash: %d cached, %d written, %d failed", cached + written + failed, cached,
-             written, failed);
-    if (failed > 0) {
-      ESP_LOGE(TAG, "Error saving %d preferences to flash. Last error=%s for key=%s", failed, esp_err_to_name(last_err),
-               last_key.c_str());
+    if (actual_len != len) {
+      ESP_LOGVV(TAG, "NVS length does not match (%u!=%u)", actual_len, len);
+      return false;
     }
-
-    // note: commit on esp-idf currently is a no-op, nvs_set_blob always writes
-    esp_err_t err = nvs_commit(nvs_handle);
+    err = nvs_get_blob(pages.nvs_handle, key.c_str(), data, &len);
     if (err != 0) {
-      ESP_LOGV(TAG, "nvs_commit() failed: %s", esp_err_to_name(err));
+      ESP_LOGV(TAG, "nvs_get_blob('%s') failed: %s", key.c_str(), esp_err_to_name(err));
       return false;
     }
-
-    return failed == 0;
+    legacy_keys.push_back(type);
+    return true;
   }
-  bool is_changed(const uint32_t nvs_handle, const NVSData &to_save) {
-    NVSData stored_data{};
-    size_t actual_len;
-    esp_err_t err = nvs_get_blob(nvs_handle, to_save.key.c_str(), nullptr, &actual_len);
-    if (err != 0) {
-      ESP_LOGV(TAG, "nvs_get_blob('%s'): %s - the key might not be set yet", to_save.key.c_str(), esp_err_to_name(err));
-      return true;
-    }
-    stored_data.data.resize(actual_len);
-    err = nvs_get_blob(nvs_handle, to_save.key.c_str(), stored_data.data.data(), &actual_len);
-    if (err != 0) {
-      ESP_LOGV(TAG, "nvs_get_blob('%s') failed: %s", to_save.key.c_str(), esp_err_to_name(err));
-      return true;
+
+  bool sync() override {
+    if (!store.sync())
+      return false;
+    if (!legacy_keys.empty() && !store.is_dirty()) {
+      for (uint32_t type : legacy_keys)
+        nvs_erase_key(pages.nvs_handle, str_sprintf("%" PRIu32, type).c_str());
+      nvs_commit(pages.nvs_handle);
+      ESP_LOGD(TAG, "Moved %u preferences into the preference pages", legacy_keys.size());
+      legacy_keys.clear();
     }
-    return to_save.data != stored_data.data;
+    return true;
   }
 
   bool reset() override {
     ESP_LOGD(TAG, "Cleaning up preferences in flash...");
-    s_pending_save.clear();
-
-    nvs_flash_deinit();
-    nvs_flash_erase();
-    // Make the handle invalid to prevent any saves until restart
-    nvs_handle = 0;
-    return true;
+    legacy_keys.clear();
+    return store.reset();
   }
 };
 
+bool ESP32PreferenceBackend::save(const uint8_t *data, size_t len) { return prefs->store.save(slot, data, len); }
+
+bool ESP32PreferenceBackend::load(uint8_t *data, size_t len) {
+  if (prefs->store.load(slot, data, len))
+    return true;
+  if (!prefs->load_legacy(prefs->store.get_key(slot), data, len))
+    return false;
+  return prefs->store.save(slot, data, len);
+}
+
+static ESP32Preferences *esp32_preferences;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
 void setup_preferences() {
-  auto *prefs = new ESP32Preferences();  // NOLINT(cppcoreguidelines-owning-memory)
-  prefs->open();
-  global_preferences = prefs;
+  esp32_preferences = new ESP32Preferences();  // NOLINT(cppcoreguidelines-owning-memory)
+  esp32_preferences->open();
+  global_preferences = esp32_preferences;
 }
 
+const PreferenceStoreStats &get_preference_stats() { return esp32_preferences->store.get_stats(); }
+
 }  // namespace esp32
 
 ESPPreferences *global_preferences;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
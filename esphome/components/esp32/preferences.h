@@ -1,10 +1,14 @@
 #pragma once
 #ifdef USE_ESP32
 
+#include "esphome/core/preference_store.h"
+
 namespace esphome {
 namespace esp32 {
 
 void setup_preferences();
+/// Write statistics of the preferences, for example to check how often a configuration writes to flash.
+const PreferenceStoreStats &get_preference_stats();
 
 }  // namespace esp32
 }  // namespace esphome
@@ -0,0 +1,71 @@
+#include "advertisement.h"
+
+#include <algorithm>
+
+namespace esphome {
+namespace esp32_ble_tracker {
+
+bool AdvertisementParser::next(AdvertisementRecord *record) {
+  while (this->offset_ < this->len_) {
+    const uint8_t field_length = this->data_[this->offset_++];  // First byte is length of adv record
+    if (field_length == 0)
+      continue;  // Possible zero padded advertisement data
+    if (field_length > this->len_ - this->offset_) {
+      // truncated record
+      this->offset_ = this->len_;
+      return false;
+    }
+    // first byte of adv record is adv record type
+    record->type = this->data_[this->offset_];
+    record->length = field_length - 1;
+    record->data = &this->data_[this->offset_ + 1];
+    this->offset_ += field_length;
+    return true;
+  }
+  return false;
+}
+
+size_t AddressSet::slot_(uint64_t address) const {
+  // fold the randomly assigned low bytes into the high bits, the capacity is a power of two
+  uint64_t hash = (address ^ (address >> 29)) * 0xBF58476D1CE4E5B9ULL;
+  size_t mask = this->slots_.size() - 1;
+  size_t slot = (hash >> 32) & mask;
+  while (this->slots_[slot] != EMPTY && this->slots_[slot] != address)
+    slot = (slot + 1) & mask;
+  return slot;
+}
+
+bool AddressSet::insert(uint64_t address) {
+  // keep the load factor at or below 3/4
+  if ((this->size_ + 1) * 4 > this->slots_.size() * 3)
+    this->grow_();
+  size_t slot = this->slot_(address);
+  if (this->slots_[slot] == address)
+    return false;
+  this->slots_[slot] = address;
+  this->size_++;
+  return true;
+}
+
+bool AddressSet::contains(uint64_t address) const {
+  return !this->slots_.empty() && this->slots_[this->slot_(address)] == address;
+}
+
+void AddressSet::clear() {
+  // keep the slots, the next scan sees mostly the same devices
+  std::fill(this->slots_.begin(), this->slots_.end(), EMPTY);
+  this->size_ = 0;
+}
+
+void AddressSet::grow_() {
+  std::vector<uint64_t> old;
+  old.swap(this->slots_);
+  this->slots_.assign(old.empty() ? 16 : old.size() * 2, EMPTY);
+  for (uint64_t address : old) {
+    if (address != EMPTY)
+      this->slots_[this->slot_(address)] = address;
+  }
+}
+
+}  // namespace esp32_ble_tracker
+}  // namespace esphome
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Platform independent parts of the tracker's hot path, so they can be fuzzed and benchmarked on the host.
+
+namespace esphome {
+namespace esp32_ble_tracker {
+
+/// AD types from the Generic Access Profile assigned numbers.
+enum AdvertisementType : uint8_t {
+  AD_TYPE_FLAG = 0x01,
+  AD_TYPE_16SRV_PART = 0x02,
+  AD_TYPE_16SRV_CMPL = 0x03,
+  AD_TYPE_32SRV_PART = 0x04,
+  AD_TYPE_32SRV_CMPL = 0x05,
+  AD_TYPE_128SRV_PART = 0x06,
+  AD_TYPE_128SRV_CMPL = 0x07,
+  AD_TYPE_NAME_SHORT = 0x08,
+  AD_TYPE_NAME_CMPL = 0x09,
+  AD_TYPE_TX_PWR = 0x0A,
+  AD_TYPE_INT_RANGE = 0x12,
+  AD_TYPE_SERVICE_DATA = 0x16,
+  AD_TYPE_APPEARANCE = 0x19,
+  AD_TYPE_32SERVICE_DATA = 0x20,
+  AD_TYPE_128SERVICE_DATA = 0x21,
+  AD_TYPE_MANUFACTURER_SPECIFIC = 0xFF,
+};
+
+/// One AD structure of the advertising data, pointing into the received bytes.
+struct AdvertisementRecord {
+  uint8_t type;
+  uint8_t length;
+  const uint8_t *data;
+};
+
+/** Walks the AD structures of advertising data (advertisement and scan response) without copying anything.
+ *
+ * Zero length structures are padding and skipped. A structure that claims more bytes than are left ends the data.
+ */
+class AdvertisementParser {
+ public:
+  AdvertisementParser(const uint8_t *data, size_t len) : data_(data), len_(len) {}
+
+  /// Fill record with the next AD structure, returns false at the end of the data.
+  bool next(AdvertisementRecord *record);
+
+ protected:
+  const uint8_t *data_;
+  size_t len_;
+  size_t offset_{0};
+};
+
+/** Set of 48 bit Bluetooth addresses with open addressing and linear probing.
+ *
+ * Looking up an address takes constant time however many devices are around, and all addresses live in one array.
+ */
+class AddressSet {
+ public:
+  /// Add the address, returns false if it was already in the set.
+  bool insert(uint64_t address);
+  bool contains(uint64_t address) const;
+  size_t size() const { return this->size_; }
+  void clear();
+
+ protected:
+  /// Never a 48 bit address, marks free slots.
+  static constexpr uint64_t EMPTY = UINT64_MAX;
+
+  size_t slot_(uint64_t address) const;
+  void grow_();
+
+  std::vector<uint64_t> slots_;
+  size_t size_{0};
+};
+
+}  // namespace esp32_ble_tracker
+}  // namespace esphome
@@ -15,6 +15,7 @@
 #include <freertos/FreeRTOSConfig.h>
 #include <freertos/task.h>
 #include <nvs_flash.h>
+#include <algorithm>
 #include <cinttypes>
 
 #ifdef USE_OTA
@@ -425,9 +426,10 @@ void ESPBTDevice::parse_scan_rst(const esp_ble_gap_cb_param_t::ble_scan_result_e
     this->address_[i] = param.bda[i];
   this->address_type_ = param.ble_addr_type;
   this->rssi_ = param.rssi;
-  this->parse_adv_(param);
+  this->adv_parsed_ = false;
 
 #ifdef ESPHOME_LOG_HAS_VERY_VERBOSE
+  this->parse_adv_();
   ESP_LOGVV(TAG, "Parse Result:");
   const char *address_type = "";
   switch (this->address_type_) {
@@ -481,22 +483,29 @@ void ESPBTDevice::parse_scan_rst(const esp_ble_gap_cb_param_t::ble_scan_result_e
   ESP_LOGVV(TAG, "Adv data: %s", format_hex_pretty(param.ble_adv, param.adv_data_len + param.scan_rsp_len).c_str());
 #endif
 }
-void ESPBTDevice::parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param) {
-  size_t offset = 0;
-  const uint8_t *payload = param.ble_adv;
-  uint8_t len = param.adv_data_len + param.scan_rsp_len;
-
-  while (offset + 2 < len) {
-    const uint8_t field_length = payload[offset++];  // First byte is length of adv record
-    if (field_length == 0) {
-      continue;  // Possible zero padded advertisement data
-    }
+AdvertisementParser ESPBTDevice::get_advertisement_records() const {
+  size_t len = this->scan_result_.adv_data_len + this->scan_result_.scan_rsp_len;
+  return AdvertisementParser(this->scan_result_.ble_adv, std::min(len, sizeof(this->scan_result_.ble_adv)));
+}
 
-    // first byte of adv record is adv record type
-    const uint8_t record_type = payload[offset++];
-    const uint8_t *record = &payload[offset];
-    const uint8_t record_length = field_length - 1;
-    offset += record_length;
+void ESPBTDevice::parse_adv_() const {
+  if (this->adv_parsed_)
+    return;
+  this->adv_parsed_ = true;
+  this->name_.clear();
+  this->tx_powers_.clear();
+  this->appearance_.reset();
+  this->ad_flag_.reset();
+  this->service_uuids_.clear();
+  this->manufacturer_datas_.clear();
+  this->service_datas_.clear();
+
+  auto parser = this->get_advertisement_records();
+  AdvertisementRecord adv_record{};
+  while (parser.next(&adv_record)) {
+    const uint8_t record_type = adv_record.type;
+    const uint8_t *record = adv_record.data;
+    const uint8_t record_length = adv_record.length;
 
     // See also Generic Access Profile Assigned Numbers:
     // https://www.bluetooth.com/specifications/assigned-numbers/generic-access-profile/ See also ADVERTISING AND SCAN
@@ -505,8 +514,8 @@ void ESPBTDevice::parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_p
     // (called CSS here)
 
     switch (record_type) {
-      case ESP_BLE_AD_TYPE_NAME_SHORT:
-      case ESP_BLE_AD_TYPE_NAME_CMPL: {
+      case AD_TYPE_NAME_SHORT:
+      case AD_TYPE_NAME_CMPL: {
         // CSS 1.2 LOCAL NAME
         // "The Local Name data type shall be the same as, or a shortened version of, the local name assigned to the
         // device." CSS 1: Optional in this context; shall not appear more than once in a block.
@@ -514,32 +523,38 @@ void ESPBTDevice::parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_p
         // "The Shortened Local Name data type defines a shortened version of the Local Name data type. The Shortened
         // Local Name data type shall not be used to advertise a name that is longer than the Local Name data type."
         if (record_length > this->name_.length()) {
-          this->name_ = std::string(reinterpret_cast<const char *>(record), record_length);
+          this->name_.assign(reinterpret_cast<const char *>(record), record_length);
         }
         break;
       }
-      case ESP_BLE_AD_TYPE_TX_PWR: {
+      case AD_TYPE_TX_PWR: {
         // CSS 1.5 TX POWER LEVEL
         // "The TX Power Level data type indicates the transmitted power level of the packet containing the data type."
         // CSS 1: Optional in this context (may appear more than once in a block).
-        this->tx_powers_.push_back(*payload);
+        if (record_length < 1)
+          break;
+        this->tx_powers_.push_back(static_cast<int8_t>(*record));
         break;
       }
-      case ESP_BLE_AD_TYPE_APPEARANCE: {
+      case AD_TYPE_APPEARANCE: {
         // CSS 1.12 APPEARANCE
         // "The Appearance data type defines the external appearance of the device."
         // See also https://www.bluetooth.com/specifications/gatt/characteristics/
         // CSS 1: Optional in this context; shall not appear more than once in a block and shall not appear in both
         // the AD and SRD of the same extended advertising interval.
-        this->appearance_ = *reinterpret_cast<const uint16_t *>(record);
+        if (record_length < 2)
+          break;
+        this->appearance_ = encode_uint16(record[1], record[0]);
         break;
       }
-      case ESP_BLE_AD_TYPE_FLAG: {
+      case AD_TYPE_FLAG: {
         // CSS 1.3 FLAGS
         // "The Flags data type contains one bit Boolean flags. The Flags data type shall be included when any of the
         // Flag bits are non-zero and the advertising packet is connectable, otherwise the Flags data type may be
         // omitted."
         // CSS 1: Optional in this context; shall not appear more than once in a block.
+        if (record_length < 1)
+          break;
         this->ad_flag_ = *record;
         break;
       }
@@ -547,29 +562,32 @@ void ESPBTDevice::parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_p
       // The Service UUID data type is used to include a list of Service or Service Class UUIDs.
       // There are six data types defined for the three sizes of Service UUIDs that may be returned:
       // CSS 1: Optional in this context (may appear more than once in a block).
-      case ESP_BLE_AD_TYPE_16SRV_CMPL:
-      case ESP_BLE_AD_TYPE_16SRV_PART: {
+      case AD_TYPE_16SRV_CMPL:
+      case AD_TYPE_16SRV_PART: {
         // • 16-bit Bluetooth Service UUIDs
         for (uint8_t i = 0; i < record_length / 2; i++) {
-          this->service_uuids_.push_back(ESPBTUUID::from_uint16(*reinterpret_cast<const uint16_t *>(record + 2 * i)));
+          this->service_uuids_.push_back(ESPBTUUID::from_uint16(encode_uint16(record[2 * i + 1], record[2 * i])));
         }
         break;
       }
-      case ESP_BLE_AD_TYPE_32SRV_CMPL:
-      case ESP_BLE_AD_TYPE_32SRV_PART: {
+      case AD_TYPE_32SRV_CMPL:
+      case AD_TYPE_32SRV_PART: {
         // • 32-bit Bluetooth Service UUIDs
         for (uint8_t i = 0; i < record_length / 4; i++) {
-          this->service_uuids_.push_back(ESPBTUUID::from_uint32(*reinterpret_cast<const uint32_t *>(record + 4 * i)));
+          const uint8_t *uuid = record + 4 * i;
+          this->service_uuids_.push_back(ESPBTUUID::from_uint32(encode_uint32(uuid[3], uuid[2], uuid[1], uuid[0])));
         }
         break;
       }
-      case ESP_BLE_AD_TYPE_128SRV_CMPL:
-      case ESP_BLE_AD_TYPE_128SRV_PART: {
+      case AD_TYPE_128SRV_CMPL:
+      case AD_TYPE_128SRV_PART: {
         // • Global 128-bit Service UUIDs
-        this->service_uuids_.push_back(ESPBTUUID::from_raw(record));
+        for (uint8_t i = 0; i < record_length / 16; i++) {
+          this->service_uuids_.push_back(ESPBTUUID::from_raw(record + 16 * i));
+        }
         break;
       }
-      case ESP_BLE_AD_MANUFACTURER_SPECIFIC_TYPE: {
+      case AD_TYPE_MANUFACTURER_SPECIFIC: {
         // CSS 1.4 MANUFACTURER SPECIFIC DATA
         // "The Manufacturer Specific data type is used for manufacturer specific data. The first two data octets shall
         // contain a company identifier from Assigned Numbers. The interpretation of any other octets within the data
@@ -580,7 +598,7 @@ void ESPBTDevice::parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_p
           break;
         }
         ServiceData data{};
-        data.uuid = ESPBTUUID::from_uint16(*reinterpret_cast<const uint16_t *>(record));
+        data.uuid = ESPBTUUID::from_uint16(encode_uint16(record[1], record[0]));
         data.data.assign(record + 2UL, record + record_length);
         this->manufacturer_datas_.push_back(data);
         break;
@@ -589,7 +607,7 @@ void ESPBTDevice::parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_p
       // CSS 1.11 SERVICE DATA
       // "The Service Data data type consists of a service UUID with the data associated with that service."
       // CSS 1: Optional in this context (may appear more than once in a block).
-      case ESP_BLE_AD_TYPE_SERVICE_DATA: {
+      case AD_TYPE_SERVICE_DATA: {
         // «Service Data - 16 bit UUID»
         // Size: 2 or more octets
         // The first 2 octets contain the 16 bit Service UUID fol- lowed by additional service data
@@ -598,12 +616,12 @@ void ESPBTDevice::parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_p
           break;
         }
         ServiceData data{};
-        data.uuid = ESPBTUUID::from_uint16(*reinterpret_cast<const uint16_t *>(record));
+        data.uuid = ESPBTUUID::from_uint16(encode_uint16(record[1], record[0]));
         data.data.assign(record + 2UL, record + record_length);
         this->service_datas_.push_back(data);
         break;
       }
-      case ESP_BLE_AD_TYPE_32SERVICE_DATA: {
+      case AD_TYPE_32SERVICE_DATA: {
         // «Service Data - 32 bit UUID»
         // Size: 4 or more octets
         // The first 4 octets contain the 32 bit Service UUID fol- lowed by additional service data
@@ -612,12 +630,12 @@ void ESPBTDevice::parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_p
           break;
         }
         ServiceData data{};
-        data.uuid = ESPBTUUID::from_uint32(*reinterpret_cast<const uint32_t *>(record));
+        data.uuid = ESPBTUUID::from_uint32(encode_uint32(record[3], record[2], record[1], record[0]));
         data.data.assign(record + 4UL, record + record_length);
         this->service_datas_.push_back(data);
         break;
       }
-      case ESP_BLE_AD_TYPE_128SERVICE_DATA: {
+      case AD_TYPE_128SERVICE_DATA: {
         // «Service Data - 128 bit UUID»
         // Size: 16 or more octets
         // The first 16 octets contain the 128 bit Service UUID followed by additional service data
@@ -631,7 +649,7 @@ void ESPBTDevice::parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_p
         this->service_datas_.push_back(data);
         break;
       }
-      case ESP_BLE_AD_TYPE_INT_RANGE:
+      case AD_TYPE_INT_RANGE:
         // Avoid logging this as it's very verbose
         break;
       default: {
@@ -659,12 +677,8 @@ void ESP32BLETracker::dump_config() {
 }
 
 void ESP32BLETracker::print_bt_device_info(const ESPBTDevice &device) {
-  const uint64_t address = device.address_uint64();
-  for (auto &disc : this->already_discovered_) {
-    if (disc == address)
-      return;
-  }
-  this->already_discovered_.push_back(address);
+  if (!this->already_discovered_.insert(device.address_uint64()))
+    return;
 
   ESP_LOGD(TAG, "Found device %s RSSI=%d", device.address_str().c_str(), device.get_rssi());
 
@@ -228,6 +228,7 @@ class FastLEDLightOutput : public light::AddressableLight {
     return {&this->leds_[index].r,      &this->leds_[index].g, &this->leds_[index].b, nullptr,
             &this->effect_data_[index], &this->correction_};
   }
+  int32_t get_stride_internal() const override { return sizeof(CRGB); }
 
   CLEDController *controller_{nullptr};
   CRGB *leds_{nullptr};
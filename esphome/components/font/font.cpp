@@ -51,8 +51,39 @@ Font::Font(const GlyphData *data, int data_nr, int baseline, int height, uint8_t
   glyphs_.reserve(data_nr);
   for (int i = 0; i < data_nr; ++i)
     glyphs_.emplace_back(&data[i]);
+
+  for (int16_t &glyph : this->ascii_glyphs_)
+    glyph = GLYPH_NONE;
+  for (int i = 0; i < data_nr; ++i) {
+    const uint8_t *a_char = data[i].a_char;
+    if (a_char[0] >= ASCII_GLYPHS)
+      continue;
+    if (a_char[1] != '\0' || this->ascii_glyphs_[a_char[0]] != GLYPH_NONE) {
+      this->ascii_glyphs_[a_char[0]] = GLYPH_SEARCH;
+    } else {
+      this->ascii_glyphs_[a_char[0]] = i;
+    }
+  }
 }
 int Font::match_next_glyph(const uint8_t *str, int *match_length) {
+  if (*str < ASCII_GLYPHS) {
+    const int16_t glyph = this->ascii_glyphs_[*str];
+    if (glyph == GLYPH_NONE) {
+      *match_length = 0;
+      return -1;
+    }
+    if (glyph != GLYPH_SEARCH) {
+      *match_length = 1;
+      return glyph;
+    }
+  }
+  return this->search_glyph_(str, match_length);
+}
+int Font::search_glyph_(const uint8_t *str, int *match_length) const {
+  if (this->glyphs_.empty()) {
+    *match_length = 0;
+    return -1;
+  }
   int lo = 0;
   int hi = this->glyphs_.size() - 1;
   while (lo != hi) {
@@ -135,8 +166,11 @@ void Font::print(int x_start, int y_start, display::Display *display, Color colo
     auto diff_b = (float) color.b - (float) background.b;
     auto b_r = (float) background.r;
     auto b_g = (float) background.g;
-    auto b_b = (float) background.g;
+    auto b_b = (float) background.b;
     for (int glyph_y = y_start + scan_y1; glyph_y != max_y; glyph_y++) {
+      // fully covered pixels are collected into horizontal runs and drawn with a single call
+      int run_start = 0;
+      int run_length = 0;
       for (int glyph_x = x_at + scan_x1; glyph_x != max_x; glyph_x++) {
         uint8_t pixel = 0;
         for (int bit_num = 0; bit_num != this->bpp_; bit_num++) {
@@ -150,14 +184,24 @@ void Font::print(int x_start, int y_start, display::Display *display, Color colo
           bitmask >>= 1;
         }
         if (pixel == bpp_max) {
-          display->draw_pixel_at(glyph_x, glyph_y, color);
-        } else if (pixel != 0) {
+          if (run_length == 0)
+            run_start = glyph_x;
+          run_length++;
+          continue;
+        }
+        if (run_length != 0) {
+          display->horizontal_line(run_start, glyph_y, run_length, color);
+          run_length = 0;
+        }
+        if (pixel != 0) {
           auto on = (float) pixel / (float) bpp_max;
           auto blended =
               Color((uint8_t) (diff_r * on + b_r), (uint8_t) (diff_g * on + b_g), (uint8_t) (diff_b * on + b_b));
           display->draw_pixel_at(glyph_x, glyph_y, blended);
         }
       }
+      if (run_length != 0)
+        display->horizontal_line(run_start, glyph_y, run_length, color);
     }
     x_at += glyph.glyph_data_->width + glyph.glyph_data_->offset_x;
 
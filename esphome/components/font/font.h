@@ -60,7 +60,18 @@ class Font : public display::BaseFont {
   const std::vector<Glyph, ExternalRAMAllocator<Glyph>> &get_glyphs() const { return glyphs_; }
 
  protected:
+  /// Number of single byte (ASCII) characters that are looked up directly.
+  static constexpr uint8_t ASCII_GLYPHS = 128;
+  /// Entry in ascii_glyphs_ for characters that aren't in the font.
+  static constexpr int16_t GLYPH_NONE = -1;
+  /// Entry in ascii_glyphs_ for characters that also start a longer glyph, these need the binary search.
+  static constexpr int16_t GLYPH_SEARCH = -2;
+
+  int search_glyph_(const uint8_t *str, int *match_length) const;
+
   std::vector<Glyph, ExternalRAMAllocator<Glyph>> glyphs_;
+  /// Glyph index for every single byte character, so that most text is rendered without searching the glyphs.
+  int16_t ascii_glyphs_[ASCII_GLYPHS];
   int baseline_;
   int height_;
   uint8_t bpp_;  // bits per pixel
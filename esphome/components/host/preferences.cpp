@@ -1,9 +1,11 @@
 #ifdef USE_HOST
 
+#include <cinttypes>
 #include <filesystem>
 #include <fstream>
 #include "preferences.h"
 #include "esphome/core/application.h"
+#include "esphome/core/log.h"
 
 namespace esphome {
 namespace host {
@@ -11,17 +13,55 @@ namespace fs = std::filesystem;
 
 static const char *const TAG = "host.preferences";
 
+bool HostPreferencePages::read_page(uint8_t page, std::vector<uint8_t> &data) {
+  std::ifstream file(this->page_filename_(page), std::ios::binary);
+  if (!file)
+    return false;
+  data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  return !file.bad();
+}
+
+bool HostPreferencePages::write_page(uint8_t page, const uint8_t *data, size_t len) {
+  std::ofstream file(this->page_filename_(page), std::ios::binary | std::ios::trunc);
+  file.write(reinterpret_cast<const char *>(data), len);
+  file.close();
+  return !file.fail();
+}
+
+bool HostPreferencePages::append_page(uint8_t page, const uint8_t *data, size_t len) {
+  std::ofstream file(this->page_filename_(page), std::ios::binary | std::ios::app);
+  file.write(reinterpret_cast<const char *>(data), len);
+  file.close();
+  return !file.fail();
+}
+
+bool HostPreferencePages::erase() {
+  std::error_code ec;
+  for (uint8_t page = 0; page < HOST_PREFERENCE_PAGES; page++)
+    fs::remove(this->page_filename_(page), ec);
+  fs::remove(this->filename, ec);
+  return true;
+}
+
 void HostPreferences::setup_() {
   if (this->setup_complete_)
     return;
-  this->filename_.append(getenv("HOME"));
-  this->filename_.append("/.esphome");
-  this->filename_.append("/prefs");
-  fs::create_directories(this->filename_);
-  this->filename_.append("/");
-  this->filename_.append(App.get_name());
-  this->filename_.append(".prefs");
-  FILE *fp = fopen(this->filename_.c_str(), "rb");
+  this->pages_.filename.append(getenv("HOME"));
+  this->pages_.filename.append("/.esphome");
+  this->pages_.filename.append("/prefs");
+  fs::create_directories(this->pages_.filename);
+  this->pages_.filename.append("/");
+  this->pages_.filename.append(App.get_name());
+  this->pages_.filename.append(".prefs");
+  this->store_.open();
+  this->load_legacy_();
+  this->setup_complete_ = true;
+}
+
+void HostPreferences::load_legacy_() {
+  if (this->store_.is_loaded())
+    return;
+  FILE *fp = fopen(this->pages_.filename.c_str(), "rb");
   if (fp != nullptr) {
     while (!feof((fp))) {
       uint32_t key;
@@ -33,36 +73,38 @@ void HostPreferences::setup_() {
       uint8_t data[len];
       if (fread(data, sizeof(uint8_t), len, fp) != len)
         break;
-      std::vector vec(data, data + len);
-      this->data[key] = vec;
+      int slot = this->store_.add(key, len);
+      if (slot >= 0)
+        this->store_.save(slot, data, len);
     }
     fclose(fp);
   }
-  this->setup_complete_ = true;
 }
 
 bool HostPreferences::sync() {
   this->setup_();
-  FILE *fp = fopen(this->filename_.c_str(), "wb");
-  std::map<uint32_t, std::vector<uint8_t>>::iterator it;
-
-  for (it = this->data.begin(); it != this->data.end(); ++it) {
-    fwrite(&it->first, sizeof(uint32_t), 1, fp);
-    uint8_t len = it->second.size();
-    fwrite(&len, sizeof(len), 1, fp);
-    fwrite(it->second.data(), sizeof(uint8_t), it->second.size(), fp);
+  bool success = this->store_.sync();
+  if (success && !this->store_.is_dirty()) {
+    // everything is in the pages now
+    std::error_code ec;
+    fs::remove(this->pages_.filename, ec);
   }
-  fclose(fp);
-  return true;
+  return success;
 }
 
 bool HostPreferences::reset() {
-  host_preferences->data.clear();
-  return true;
+  this->setup_();
+  return this->store_.reset();
 }
 
 ESPPreferenceObject HostPreferences::make_preference(size_t length, uint32_t type, bool in_flash) {
-  auto backend = new HostPreferenceBackend(type);
+  this->setup_();
+  int slot = this->store_.add(type, length);
+  if (slot < 0) {
+    ESP_LOGE(TAG, "No room for preference %" PRIu32 " (%zu bytes)", type, length);
+    return {};
+  }
+  auto backend = new HostPreferenceBackend(slot);
   return ESPPreferenceObject(backend);
 };
 
@@ -73,10 +115,10 @@ void setup_preferences() {
 }
 
 bool HostPreferenceBackend::save(const uint8_t *data, size_t len) {
-  return host_preferences->save(this->key_, data, len);
+  return host_preferences->save(this->slot_, data, len);
 }
 
-bool HostPreferenceBackend::load(uint8_t *data, size_t len) { return host_preferences->load(this->key_, data, len); }
+bool HostPreferenceBackend::load(uint8_t *data, size_t len) { return host_preferences->load(this->slot_, data, len); }
 
 HostPreferences *host_preferences;
 }  // namespace host
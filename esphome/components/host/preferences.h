@@ -3,20 +3,40 @@
 #ifdef USE_HOST
 
 #include "esphome/core/preferences.h"
-#include <map>
+#include "esphome/core/preference_store.h"
+#include <string>
+#include <vector>
 
 namespace esphome {
 namespace host {
 
+static const uint8_t HOST_PREFERENCE_PAGES = 2;
+/// Changed preferences are appended to a page file until it reaches this size.
+static const size_t HOST_PREFERENCE_PAGE_SIZE = 4096;
+
 class HostPreferenceBackend : public ESPPreferenceBackend {
  public:
-  explicit HostPreferenceBackend(uint32_t key) { this->key_ = key; }
+  explicit HostPreferenceBackend(int slot) { this->slot_ = slot; }
 
   bool save(const uint8_t *data, size_t len) override;
   bool load(uint8_t *data, size_t len) override;
 
  protected:
-  uint32_t key_{};
+  int slot_{};
+};
+
+/// Each page is a file next to the preferences file of earlier versions.
+class HostPreferencePages : public PreferenceStorePages {
+ public:
+  bool read_page(uint8_t page, std::vector<uint8_t> &data) override;
+  bool write_page(uint8_t page, const uint8_t *data, size_t len) override;
+  bool append_page(uint8_t page, const uint8_t *data, size_t len) override;
+  bool erase() override;
+
+  std::string filename{};
+
+ protected:
+  std::string page_filename_(uint8_t page) const { return this->filename + "." + std::to_string(page); }
 };
 
 class HostPreferences : public ESPPreferences {
@@ -29,33 +49,18 @@ class HostPreferences : public ESPPreferences {
     return make_preference(length, type, false);
   }
 
-  bool save(uint32_t key, const uint8_t *data, size_t len) {
-    if (len > 255)
-      return false;
-    this->setup_();
-    std::vector vec(data, data + len);
-    this->data[key] = vec;
-    return true;
-  }
+  bool save(int slot, const uint8_t *data, size_t len) { return this->store_.save(slot, data, len); }
+  bool load(int slot, uint8_t *data, size_t len) { return this->store_.load(slot, data, len); }
 
-  bool load(uint32_t key, uint8_t *data, size_t len) {
-    if (len > 255)
-      return false;
-    this->setup_();
-    if (this->data.count(key) == 0)
-      return false;
-    auto vec = this->data[key];
-    if (vec.size() != len)
-      return false;
-    memcpy(data, vec.data(), len);
-    return true;
-  }
+  const PreferenceStoreStats &get_stats() const { return this->store_.get_stats(); }
 
  protected:
   void setup_();
+  /// Load the preferences file of earlier versions, if there are no pages yet.
+  void load_legacy_();
   bool setup_complete_{};
-  std::string filename_{};
-  std::map<uint32_t, std::vector<uint8_t>> data{};
+  HostPreferencePages pages_{};
+  PreferenceStore store_{&this->pages_, HOST_PREFERENCE_PAGES, HOST_PREFERENCE_PAGE_SIZE};
 };
 void setup_preferences();
 extern HostPreferences *host_preferences;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
@@ -57,10 +57,8 @@ void ILI9XXXDisplay::setup() {
 
   this->set_madctl();
   this->command(this->pre_invertcolors_ ? ILI9XXX_INVON : ILI9XXX_INVOFF);
-  this->x_low_ = this->width_;
-  this->y_low_ = this->height_;
-  this->x_high_ = 0;
-  this->y_high_ = 0;
+  // the display memory holds random data after reset, so the first update sends the whole buffer
+  this->mark_all_dirty_();
 }
 
 void ILI9XXXDisplay::alloc_buffer_() {
@@ -131,35 +129,61 @@ void ILI9XXXDisplay::fill(Color color) {
   if (!this->check_buffer_())
     return;
   uint16_t new_color = 0;
-  this->x_low_ = 0;
-  this->y_low_ = 0;
-  this->x_high_ = this->get_width_internal() - 1;
-  this->y_high_ = this->get_height_internal() - 1;
   switch (this->buffer_color_mode_) {
     case BITS_8_INDEXED:
       new_color = display::ColorUtil::color_to_index8_palette888(color, this->palette_);
       break;
     case BITS_16:
       new_color = display::ColorUtil::color_to_565(color);
-      {
-        const uint32_t buffer_length_16_bits = this->get_buffer_length_() * 2;
-        if (((uint8_t) (new_color >> 8)) == ((uint8_t) new_color)) {
-          // Upper and lower is equal can use quicker memset operation. Takes ~20ms.
-          memset(this->buffer_, (uint8_t) new_color, buffer_length_16_bits);
-        } else {
-          for (uint32_t i = 0; i < buffer_length_16_bits; i = i + 2) {
-            this->buffer_[i] = (uint8_t) (new_color >> 8);
-            this->buffer_[i + 1] = (uint8_t) new_color;
-          }
-        }
-      }
-      return;
       break;
     default:
       new_color = display::ColorUtil::color_to_332(color, display::ColorOrder::COLOR_ORDER_RGB);
       break;
   }
-  memset(this->buffer_, (uint8_t) new_color, this->get_buffer_length_());
+
+  // Only rows that don't have the fill color yet are marked dirty. Screens that are cleared and redrawn with mostly
+  // the same content then only transfer the parts that have something drawn on them.
+  const int width = this->get_width_internal();
+  const int height = this->get_height_internal();
+  if (this->buffer_color_mode_ == BITS_16) {
+    const uint8_t high = new_color >> 8;
+    const uint8_t low = new_color;
+    for (int y = 0; y < height; y++) {
+      uint8_t *row = this->buffer_ + y * width * 2;
+      int first = 0;
+      while (first < width && row[first * 2] == high && row[first * 2 + 1] == low)
+        first++;
+      if (first == width)
+        continue;
+      int last = width - 1;
+      while (row[last * 2] == high && row[last * 2 + 1] == low)
+        last--;
+      if (high == low) {
+        // Upper and lower is equal can use quicker memset operation.
+        memset(row + first * 2, high, (last - first + 1) * 2);
+      } else {
+        for (int x = first; x <= last; x++) {
+          row[x * 2] = high;
+          row[x * 2 + 1] = low;
+        }
+      }
+      this->mark_dirty_(first, y, last, y);
+    }
+    return;
+  }
+  for (int y = 0; y < height; y++) {
+    uint8_t *row = this->buffer_ + y * width;
+    int first = 0;
+    while (first < width && row[first] == (uint8_t) new_color)
+      first++;
+    if (first == width)
+      continue;
+    int last = width - 1;
+    while (row[last] == (uint8_t) new_color)
+      last--;
+    memset(row + first, (uint8_t) new_color, last - first + 1);
+    this->mark_dirty_(first, y, last, y);
+  }
 }
 
 void HOT ILI9XXXDisplay::draw_absolute_pixel_internal(int x, int y, Color color) {
@@ -195,15 +219,8 @@ void HOT ILI9XXXDisplay::draw_absolute_pixel_internal(int x, int y, Color color)
     updated = true;
   }
   if (updated) {
-    // low and high watermark may speed up drawing from buffer
-    if (x < this->x_low_)
-      this->x_low_ = x;
-    if (y < this->y_low_)
-      this->y_low_ = y;
-    if (x > this->x_high_)
-      this->x_high_ = x;
-    if (y > this->y_high_)
-      this->y_high_ = y;
+    // only changed regions are sent to the display
+    this->mark_dirty_(x, y);
   }
 }
 
@@ -222,14 +239,17 @@ void ILI9XXXDisplay::update() {
 }
 
 void ILI9XXXDisplay::display_() {
-  // check if something was displayed
-  if ((this->x_high_ < this->x_low_) || (this->y_high_ < this->y_low_)) {
-    return;
+  // only the changed regions are sent to the display
+  for (uint8_t i = 0; i < this->get_dirty_count_(); i++) {
+    const display::Rect &rect = this->get_dirty_rects_()[i];
+    this->display_rect_(rect.x, rect.y, rect.x2() - 1, rect.y2() - 1);
   }
+  this->clear_dirty_();
+}
 
-  // we will only update the changed rows to the display
-  size_t const w = this->x_high_ - this->x_low_ + 1;
-  size_t const h = this->y_high_ - this->y_low_ + 1;
+void ILI9XXXDisplay::display_rect_(uint16_t x_low, uint16_t y_low, uint16_t x_high, uint16_t y_high) {
+  size_t const w = x_high - x_low + 1;
+  size_t const h = y_high - y_low + 1;
 
   size_t mhz = this->data_rate_ / 1000000;
   // estimate time for a single write
@@ -239,22 +259,21 @@ void ILI9XXXDisplay::display_() {
   ESP_LOGV(TAG,
            "Start display(xlow:%d, ylow:%d, xhigh:%d, yhigh:%d, width:%d, "
            "height:%zu, mode=%d, 18bit=%d, sw_time=%zuus, mw_time=%zuus)",
-           this->x_low_, this->y_low_, this->x_high_, this->y_high_, w, h, this->buffer_color_mode_,
-           this->is_18bitdisplay_, sw_time, mw_time);
+           x_low, y_low, x_high, y_high, w, h, this->buffer_color_mode_, this->is_18bitdisplay_, sw_time, mw_time);
   auto now = millis();
   if (this->buffer_color_mode_ == BITS_16 && !this->is_18bitdisplay_ && sw_time < mw_time) {
     // 16 bit mode maps directly to display format
     ESP_LOGV(TAG, "Doing single write of %zu bytes", this->width_ * h * 2);
-    set_addr_window_(0, this->y_low_, this->width_ - 1, this->y_high_);
-    this->write_array(this->buffer_ + this->y_low_ * this->width_ * 2, h * this->width_ * 2);
+    set_addr_window_(0, y_low, this->width_ - 1, y_high);
+    this->write_array(this->buffer_ + y_low * this->width_ * 2, h * this->width_ * 2);
   } else {
     ESP_LOGV(TAG, "Doing multiple write");
     uint8_t transfer_buffer[ILI9XXX_TRANSFER_BUFFER_SIZE];
     size_t rem = h * w;  // remaining number of pixels to write
-    set_addr_window_(this->x_low_, this->y_low_, this->x_high_, this->y_high_);
+    set_addr_window_(x_low, y_low, x_high, y_high);
     size_t idx = 0;    // index into transfer_buffer
     size_t pixel = 0;  // pixel number offset
-    size_t pos = this->y_low_ * this->width_ + this->x_low_;
+    size_t pos = y_low * this->width_ + x_low;
     while (rem-- != 0) {
       uint16_t color_val;
       switch (this->buffer_color_mode_) {
@@ -296,11 +315,6 @@ void ILI9XXXDisplay::display_() {
   }
   this->end_data_();
   ESP_LOGV(TAG, "Data write took %dms", (unsigned) (millis() - now));
-  // invalidate watermarks
-  this->x_low_ = this->width_;
-  this->y_low_ = this->height_;
-  this->x_high_ = 0;
-  this->y_high_ = 0;
 }
 
 // note that this bypasses the buffer and writes directly to the display.
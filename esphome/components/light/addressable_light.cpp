@@ -1,6 +1,10 @@
 #include "addressable_light.h"
+#include "esp_color_span.h"
 #include "esphome/core/log.h"
 
+#include <algorithm>
+#include <cstring>
+
 namespace esphome {
 namespace light {
 
@@ -27,6 +31,106 @@ std::unique_ptr<LightTransformer> AddressableLight::create_default_transition()
   return make_unique<AddressableLightTransformer>(*this);
 }
 
+// Below this size the lookup tables (2KB) cost more than correcting every channel on its own.
+static const int32_t CORRECTION_TABLES_MIN_SIZE = 64;
+
+bool AddressableLight::use_correction_tables_() const {
+  return this->get_stride_internal() != 0 && this->size() >= CORRECTION_TABLES_MIN_SIZE;
+}
+
+void AddressableLight::get_colors(int32_t index, Color *colors, int32_t count) {
+  index = interpret_index(index, this->size());
+  if (!this->use_correction_tables_()) {
+    for (int32_t i = 0; i < count; i++)
+      colors[i] = this->get_view_internal(index + i).get();
+    return;
+  }
+  const int32_t stride = this->get_stride_internal();
+  const ESPColorView first = this->get_view_internal(index);
+  const uint8_t *table = this->correction_.get_uncorrect_table();
+  const uint8_t *red = first.red_;
+  const uint8_t *green = first.green_;
+  const uint8_t *blue = first.blue_;
+  const uint8_t *white = first.white_;
+  for (int32_t i = 0; i < count; i++) {
+    colors[i] = Color(table[*red], table[256 + *green], table[512 + *blue], white != nullptr ? table[768 + *white] : 0);
+    red += stride;
+    green += stride;
+    blue += stride;
+    if (white != nullptr)
+      white += stride;
+  }
+}
+
+void AddressableLight::set_colors(int32_t index, const Color *colors, int32_t count) {
+  this->set_colors_(index, colors, count, true);
+}
+
+void AddressableLight::set_colors_rgb(int32_t index, const Color *colors, int32_t count) {
+  this->set_colors_(index, colors, count, false);
+}
+
+void AddressableLight::set_colors_(int32_t index, const Color *colors, int32_t count, bool set_white) {
+  index = interpret_index(index, this->size());
+  if (!this->use_correction_tables_()) {
+    for (int32_t i = 0; i < count; i++) {
+      ESPColorView view = this->get_view_internal(index + i);
+      if (set_white) {
+        view.set(colors[i]);
+      } else {
+        view.set_rgb(colors[i].red, colors[i].green, colors[i].blue);
+      }
+    }
+    return;
+  }
+  const int32_t stride = this->get_stride_internal();
+  const ESPColorView first = this->get_view_internal(index);
+  const uint8_t *table = this->correction_.get_correct_table();
+  uint8_t *red = first.red_;
+  uint8_t *green = first.green_;
+  uint8_t *blue = first.blue_;
+  uint8_t *white = set_white ? first.white_ : nullptr;
+  for (int32_t i = 0; i < count; i++) {
+    *red = table[colors[i].red];
+    *green = table[256 + colors[i].green];
+    *blue = table[512 + colors[i].blue];
+    red += stride;
+    green += stride;
+    blue += stride;
+    if (white != nullptr) {
+      *white = table[768 + colors[i].white];
+      white += stride;
+    }
+  }
+}
+
+void AddressableLight::get_effect_data(int32_t index, uint8_t *effect_data, int32_t count) {
+  index = interpret_index(index, this->size());
+  if (this->get_stride_internal() == 0) {
+    for (int32_t i = 0; i < count; i++)
+      effect_data[i] = this->get_view_internal(index + i).get_effect_data();
+    return;
+  }
+  const uint8_t *src = this->get_view_internal(index).effect_data_;
+  if (src == nullptr) {
+    memset(effect_data, 0, count);
+  } else {
+    memcpy(effect_data, src, count);
+  }
+}
+
+void AddressableLight::set_effect_data(int32_t index, const uint8_t *effect_data, int32_t count) {
+  index = interpret_index(index, this->size());
+  if (this->get_stride_internal() == 0) {
+    for (int32_t i = 0; i < count; i++)
+      this->get_view_internal(index + i).set_effect_data(effect_data[i]);
+    return;
+  }
+  uint8_t *dst = this->get_view_internal(index).effect_data_;
+  if (dst != nullptr)
+    memcpy(dst, effect_data, count);
+}
+
 Color color_from_light_color_values(LightColorValues val) {
   auto r = to_uint8_scale(val.get_color_brightness() * val.get_red());
   auto g = to_uint8_scale(val.get_color_brightness() * val.get_green());
@@ -97,10 +201,17 @@ optional<LightColorValues> AddressableLightTransformer::apply() {
 
   if (alpha8 != 0) {
     uint8_t inv_alpha8 = 255 - alpha8;
-    Color add = this->target_color_ * alpha8;
-
-    for (auto led : this->light_)
-      led.set(add + led.get() * inv_alpha8);
+    const uint32_t add = (this->target_color_ * alpha8).raw_32;
+
+    Color colors[COLOR_SPAN_CHUNK_SIZE];
+    const int32_t size = this->light_.size();
+    for (int32_t i = 0; i < size; i += COLOR_SPAN_CHUNK_SIZE) {
+      const int32_t count = std::min(size - i, COLOR_SPAN_CHUNK_SIZE);
+      this->light_.get_colors(i, colors, count);
+      for (int32_t j = 0; j < count; j++)
+        colors[j].raw_32 = color_word_add(add, color_word_scale(colors[j].raw_32, inv_alpha8));
+      this->light_.set_colors(i, colors, count);
+    }
   }
 
   this->last_transition_progress_ = smoothed_progress;
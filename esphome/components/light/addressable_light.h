@@ -40,6 +40,14 @@ class AddressableLight : public LightOutput, public Component {
     return ESPRangeView(this, from, to);
   }
   ESPRangeView all() { return ESPRangeView(this, 0, this->size()); }
+  /// Read the colors of \p count LEDs starting at \p index, same as `colors[i] = this->get(index + i).get()`.
+  void get_colors(int32_t index, Color *colors, int32_t count);
+  /// Set \p count LEDs starting at \p index, same as `this->get(index + i) = colors[i]`.
+  void set_colors(int32_t index, const Color *colors, int32_t count);
+  /// Same as set_colors(), but only sets the RGB channels and keeps the white channel of the LEDs.
+  void set_colors_rgb(int32_t index, const Color *colors, int32_t count);
+  void get_effect_data(int32_t index, uint8_t *effect_data, int32_t count);
+  void set_effect_data(int32_t index, const uint8_t *effect_data, int32_t count);
   ESPRangeIterator begin() { return this->all().begin(); }
   ESPRangeIterator end() { return this->all().end(); }
   void shift_left(int32_t amnt) {
@@ -83,6 +91,7 @@ class AddressableLight : public LightOutput, public Component {
 
  protected:
   friend class AddressableLightTransformer;
+  friend ESPRangeView;
 
   void mark_shown_() {
 #ifdef USE_POWER_SUPPLY
@@ -96,6 +105,16 @@ class AddressableLight : public LightOutput, public Component {
 #endif
   }
   virtual ESPColorView get_view_internal(int32_t index) const = 0;
+  /** Distance in bytes between the channels of neighbouring LEDs, or 0 if the LEDs aren't evenly spaced.
+   *
+   * Lights that keep all LEDs in one buffer with the same layout (and one byte of effect data per LED) return the
+   * size of an LED here. Bulk operations like get_colors() and ESPRangeView::set() then walk the buffer directly
+   * instead of creating a view for every LED.
+   */
+  virtual int32_t get_stride_internal() const { return 0; }
+  /// Whether get_colors() and set_colors() use the lookup tables of the color correction.
+  bool use_correction_tables_() const;
+  void set_colors_(int32_t index, const Color *colors, int32_t count, bool set_white);
 
   bool effect_active_{false};
   ESPColorCorrection correction_{};
@@ -1,11 +1,13 @@
 #pragma once
 
+#include <algorithm>
 #include <utility>
 #include <vector>
 
 #include "esphome/core/component.h"
 #include "esphome/components/light/light_state.h"
 #include "esphome/components/light/addressable_light.h"
+#include "esphome/components/light/esp_color_span.h"
 
 namespace esphome {
 namespace light {
@@ -81,10 +83,17 @@ class AddressableRainbowLightEffect : public AddressableLightEffect {
     hsv.saturation = 240;
     uint16_t hue = (millis() * this->speed_) % 0xFFFF;
     const uint16_t add = 0xFFFF / this->width_;
-    for (auto var : it) {
-      hsv.hue = hue >> 8;
-      var = hsv;
-      hue += add;
+    Color colors[COLOR_SPAN_CHUNK_SIZE];
+    const int32_t size = it.size();
+    for (int32_t i = 0; i < size; i += COLOR_SPAN_CHUNK_SIZE) {
+      const int32_t count = std::min(size - i, COLOR_SPAN_CHUNK_SIZE);
+      for (int32_t j = 0; j < count; j++) {
+        hsv.hue = hue >> 8;
+        colors[j] = hsv.to_rgb();
+        hue += add;
+      }
+      // only the RGB channels are set, the white channel keeps its value
+      it.set_colors_rgb(i, colors, count);
     }
     it.schedule_show();
   }
@@ -178,9 +187,7 @@ class AddressableScanEffect : public AddressableLightEffect {
     this->last_move_ = now;
 
     it.all() = Color::BLACK;
-    for (uint32_t i = 0; i < this->scan_width_; i++) {
-      it[this->at_led_ + i] = current_color;
-    }
+    it.range(this->at_led_, this->at_led_ + this->scan_width_) = current_color;
 
     it.schedule_show();
   }
@@ -204,19 +211,28 @@ class AddressableTwinkleEffect : public AddressableLightEffect {
       pos_add = pos_add32;
       this->last_progress_ += pos_add32 * this->progress_interval_;
     }
-    for (auto view : addressable) {
-      if (view.get_effect_data() != 0) {
-        const uint8_t sine = half_sin8(view.get_effect_data());
-        view = current_color * sine;
-        const uint8_t new_pos = view.get_effect_data() + pos_add;
-        if (new_pos < view.get_effect_data()) {
-          view.set_effect_data(0);
+    Color colors[COLOR_SPAN_CHUNK_SIZE];
+    uint8_t effect_data[COLOR_SPAN_CHUNK_SIZE];
+    const int32_t size = addressable.size();
+    for (int32_t i = 0; i < size; i += COLOR_SPAN_CHUNK_SIZE) {
+      const int32_t count = std::min(size - i, COLOR_SPAN_CHUNK_SIZE);
+      addressable.get_effect_data(i, effect_data, count);
+      for (int32_t j = 0; j < count; j++) {
+        if (effect_data[j] != 0) {
+          const uint8_t sine = half_sin8(effect_data[j]);
+          colors[j] = current_color * sine;
+          const uint8_t new_pos = effect_data[j] + pos_add;
+          if (new_pos < effect_data[j]) {
+            effect_data[j] = 0;
+          } else {
+            effect_data[j] = new_pos;
+          }
         } else {
-          view.set_effect_data(new_pos);
+          colors[j] = Color::BLACK;
         }
-      } else {
-        view = Color::BLACK;
       }
+      addressable.set_colors(i, colors, count);
+      addressable.set_effect_data(i, effect_data, count);
     }
     while (random_float() < this->twinkle_probability_) {
       const size_t pos = random_uint32() % addressable.size();
@@ -246,25 +262,34 @@ class AddressableRandomTwinkleEffect : public AddressableLightEffect {
       this->last_progress_ = now;
     }
     uint8_t subsine = ((8 * (now - this->last_progress_)) / this->progress_interval_) & 0b111;
-    for (auto view : it) {
-      if (view.get_effect_data() != 0) {
-        const uint8_t x = (view.get_effect_data() >> 3) & 0b11111;
-        const uint8_t color = view.get_effect_data() & 0b111;
-        const uint16_t sine = half_sin8((x << 3) | subsine);
-        if (color == 0) {
-          view = current_color * sine;
-        } else {
-          view = Color(((color >> 2) & 1) * sine, ((color >> 1) & 1) * sine, ((color >> 0) & 1) * sine);
-        }
-        const uint8_t new_x = x + pos_add;
-        if (new_x > 0b11111) {
-          view.set_effect_data(0);
+    Color colors[COLOR_SPAN_CHUNK_SIZE];
+    uint8_t effect_data[COLOR_SPAN_CHUNK_SIZE];
+    const int32_t size = it.size();
+    for (int32_t i = 0; i < size; i += COLOR_SPAN_CHUNK_SIZE) {
+      const int32_t count = std::min(size - i, COLOR_SPAN_CHUNK_SIZE);
+      it.get_effect_data(i, effect_data, count);
+      for (int32_t j = 0; j < count; j++) {
+        if (effect_data[j] != 0) {
+          const uint8_t x = (effect_data[j] >> 3) & 0b11111;
+          const uint8_t color = effect_data[j] & 0b111;
+          const uint16_t sine = half_sin8((x << 3) | subsine);
+          if (color == 0) {
+            colors[j] = current_color * sine;
+          } else {
+            colors[j] = Color(((color >> 2) & 1) * sine, ((color >> 1) & 1) * sine, ((color >> 0) & 1) * sine);
+          }
+          const uint8_t new_x = x + pos_add;
+          if (new_x > 0b11111) {
+            effect_data[j] = 0;
+          } else {
+            effect_data[j] = (new_x << 3) | color;
+          }
         } else {
-          view.set_effect_data((new_x << 3) | color);
+          colors[j] = Color(0, 0, 0, 0);
         }
-      } else {
-        view = Color(0, 0, 0, 0);
       }
+      it.set_colors(i, colors, count);
+      it.set_effect_data(i, effect_data, count);
     }
     while (random_float() < this->twinkle_probability_) {
       const size_t pos = random_uint32() % it.size();
@@ -298,18 +323,32 @@ class AddressableFireworksEffect : public AddressableLightEffect {
     this->last_update_ = now;
     // "invert" the fade out parameter so that higher values make fade out faster
     const uint8_t fade_out_mult = 255u - this->fade_out_rate_;
-    for (auto view : it) {
-      Color target = view.get() * fade_out_mult;
-      if (target.r < 64)
-        target *= 170;
-      view = target;
-    }
-    int last = it.size() - 1;
-    it[0].set(it[0].get() + (it[1].get() * 128));
-    for (int i = 1; i < last; i++) {
-      it[i] = (it[i - 1].get() * 64) + it[i].get() + (it[i + 1].get() * 64);
+    // Fade out and blur in one pass: every LED gets 1/4 of both neighbours added, the first and the last LED 1/2 of
+    // their only neighbour. The blur runs from left to right, so the left neighbour is already blurred.
+    Color colors[COLOR_SPAN_CHUNK_SIZE + 1];
+    const int32_t size = it.size();
+    const int32_t last = size - 1;
+    uint32_t left = 0;
+    for (int32_t i = 0; i < size; i += COLOR_SPAN_CHUNK_SIZE) {
+      const int32_t count = std::min(size - i, COLOR_SPAN_CHUNK_SIZE);
+      // one more LED is read as the right neighbour of the last LED in the chunk
+      const int32_t read = std::min(size - i, COLOR_SPAN_CHUNK_SIZE + 1);
+      it.get_colors(i, colors, read);
+      for (int32_t j = 0; j < read; j++) {
+        colors[j].raw_32 = color_word_scale(colors[j].raw_32, fade_out_mult);
+        if (colors[j].r < 64)
+          colors[j].raw_32 = color_word_scale(colors[j].raw_32, 170);
+      }
+      for (int32_t j = 0; j < count; j++) {
+        uint32_t value = colors[j].raw_32;
+        if (i + j > 0)
+          value = color_word_add(value, color_word_scale(left, i + j == last ? 128 : 64));
+        if (i + j < last)
+          value = color_word_add(value, color_word_scale(colors[j + 1].raw_32, i + j == 0 ? 128 : 64));
+        colors[j].raw_32 = left = value;
+      }
+      it.set_colors(i, colors, count);
     }
-    it[last] = it[last].get() + (it[last - 1].get() * 128);
     if (random_float() < this->spark_probability_) {
       const size_t pos = random_uint32() % it.size();
       if (this->use_random_color_) {
@@ -0,0 +1,151 @@
+#include "addressable_light_stream.h"
+#include "addressable_light.h"
+#include "esp_color_span.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace esphome {
+namespace light {
+
+static const char *const TAG = "light.stream";
+
+/// Restart the timing when no frame was received for this long (in microseconds).
+static const uint32_t STREAM_TIMEOUT = 1000000;
+static const uint32_t PUBLISH_INTERVAL = 1000;
+
+bool AddressableLightStream::start(int32_t size) {
+  this->stop();
+  ExternalRAMAllocator<Color> allocator(ExternalRAMAllocator<Color>::ALLOW_FAILURE);
+  this->frames_ = allocator.allocate(size * this->slot_count_());
+  if (this->frames_ == nullptr) {
+    ESP_LOGE(TAG, "Cannot allocate %u frames for %" PRId32 " LEDs, streaming without jitter buffer",
+             this->slot_count_(), size);
+    return false;
+  }
+  this->size_ = size;
+  this->clear();
+  return true;
+}
+
+void AddressableLightStream::stop() {
+  if (this->frames_ == nullptr)
+    return;
+  ExternalRAMAllocator<Color> allocator(ExternalRAMAllocator<Color>::ALLOW_FAILURE);
+  allocator.deallocate(this->frames_, this->size_ * this->slot_count_());
+  this->frames_ = nullptr;
+  this->size_ = 0;
+}
+
+void AddressableLightStream::clear() {
+  if (this->frames_ == nullptr)
+    return;
+  for (uint8_t i = 0; i < this->slot_count_(); i++)
+    this->order_[i] = i;
+  color_span_fill(this->frames_, this->size_ * this->slot_count_(), Color::BLACK);
+  this->queued_ = 0;
+  this->has_current_ = false;
+  this->receiving_ = false;
+}
+
+void AddressableLightStream::commit() {
+  const uint32_t now = micros();
+  // Frames are expected one interval apart. A frame can arrive up to the delay later than expected and still be
+  // shown in time, otherwise it's late and the timing restarts from its arrival.
+  uint32_t timestamp = now;
+  if (this->receiving_ && now - this->last_commit_ < STREAM_TIMEOUT) {
+    timestamp = this->last_timestamp_ + this->frame_interval_;
+    if (int32_t(now - timestamp) > int32_t(this->delay_())) {
+      this->late_frames_++;
+      timestamp = now;
+    } else if (int32_t(timestamp - now) > 0) {
+      // the sender is faster than the frame rate, don't let the timestamps run ahead of the frames
+      timestamp = now;
+    }
+  }
+  this->receiving_ = true;
+  this->last_commit_ = now;
+  this->last_timestamp_ = timestamp;
+
+  const uint8_t received = this->order_[this->queued_ + 1];
+  this->timestamps_[received] = timestamp;
+  if (this->queued_ == this->capacity_()) {
+    // the buffer is full, drop the oldest frame that is still waiting
+    this->dropped_frames_++;
+    const uint8_t oldest = this->order_[1];
+    memmove(&this->order_[1], &this->order_[2], this->queued_);
+    this->order_[this->queued_ + 1] = oldest;
+  } else {
+    this->queued_++;
+  }
+  // partial updates (like a single universe) apply on top of the previous frame
+  memcpy(this->frame(), this->slot_(this->queued_), this->size_ * sizeof(Color));
+}
+
+void AddressableLightStream::apply(AddressableLight &it) {
+  if (this->frames_ == nullptr)
+    return;
+  const uint32_t playout = micros() - this->delay_();
+
+  bool advanced = false;
+  while (this->queued_ > 0 && int32_t(playout - this->timestamps_[this->order_[1]]) >= 0) {
+    if (this->has_current_ && !this->current_shown_)
+      this->dropped_frames_++;
+    // the frame on the light becomes free, the next queued frame takes its place
+    const uint8_t previous = this->order_[0];
+    memmove(&this->order_[0], &this->order_[1], this->slot_count_() - 1);
+    this->order_[this->slot_count_() - 1] = previous;
+    this->queued_--;
+    this->has_current_ = true;
+    this->current_shown_ = false;
+    advanced = true;
+  }
+
+  if (this->has_current_) {
+    if (this->interpolate_ && this->queued_ > 0) {
+      const uint32_t from = this->timestamps_[this->order_[0]];
+      const uint32_t span = std::max<uint32_t>(this->timestamps_[this->order_[1]] - from, 1);
+      const uint8_t amount = std::min<uint32_t>(uint64_t(playout - from) * 255 / span, 255);
+      if (advanced || amount != this->last_amount_) {
+        const Color *current = this->slot_(0);
+        const Color *next = this->slot_(1);
+        Color colors[COLOR_SPAN_CHUNK_SIZE];
+        for (int32_t i = 0; i < this->size_; i += COLOR_SPAN_CHUNK_SIZE) {
+          const int32_t count = std::min(this->size_ - i, COLOR_SPAN_CHUNK_SIZE);
+          memcpy(colors, current + i, count * sizeof(Color));
+          color_span_blend(colors, next + i, count, amount);
+          it.set_colors(i, colors, count);
+        }
+        this->last_amount_ = amount;
+        this->current_shown_ = true;
+        it.schedule_show();
+      }
+    } else if (advanced) {
+      it.set_colors(0, this->slot_(0), this->size_);
+      this->last_amount_ = 0;
+      this->current_shown_ = true;
+      it.schedule_show();
+    }
+  }
+
+  this->publish_counters_();
+}
+
+void AddressableLightStream::publish_counters_() {
+#ifdef USE_SENSOR
+  const uint32_t now = millis();
+  if (now - this->last_publish_ < PUBLISH_INTERVAL)
+    return;
+  this->last_publish_ = now;
+  if (this->dropped_frames_sensor_ != nullptr && this->dropped_frames_sensor_->get_raw_state() != this->dropped_frames_)
+    this->dropped_frames_sensor_->publish_state(this->dropped_frames_);
+  if (this->late_frames_sensor_ != nullptr && this->late_frames_sensor_->get_raw_state() != this->late_frames_)
+    this->late_frames_sensor_->publish_state(this->late_frames_);
+#endif
+}
+
+}  // namespace light
+}  // namespace esphome
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "esphome/core/color.h"
+#include "esphome/core/defines.h"
+
+#ifdef USE_SENSOR
+#include "esphome/components/sensor/sensor.h"
+#endif
+
+namespace esphome {
+namespace light {
+
+class AddressableLight;
+
+/** Jitter buffer for effects that stream LED data from the network or a serial port.
+ *
+ * Received frames are timestamped with the expected frame rate of the sender and played out with a fixed delay of
+ * a few frames, so frames that arrive unevenly are still shown evenly spaced. Optionally the output is interpolated
+ * between two frames every time the light is written.
+ *
+ * The effect writes the LEDs of the next frame with frame() and hands it over with commit(). It calls apply() every
+ * time it runs to update the light.
+ */
+class AddressableLightStream {
+ public:
+  static const uint8_t MAX_DEPTH = 8;
+
+  void set_frame_rate(float frame_rate) { this->frame_interval_ = 1e6f / frame_rate; }
+  /// Number of frames to delay the output by, frames arriving later than that are counted as late.
+  void set_depth(uint8_t depth) { this->depth_ = depth; }
+  void set_interpolate(bool interpolate) { this->interpolate_ = interpolate; }
+#ifdef USE_SENSOR
+  void set_dropped_frames_sensor(sensor::Sensor *sensor) { this->dropped_frames_sensor_ = sensor; }
+  void set_late_frames_sensor(sensor::Sensor *sensor) { this->late_frames_sensor_ = sensor; }
+#endif
+
+  /// Allocate the frames for \p size LEDs. Returns false if there isn't enough memory for them.
+  bool start(int32_t size);
+  void stop();
+  bool is_started() const { return this->frames_ != nullptr; }
+  /// Blank all frames and restart the timing, for example after the stream timed out.
+  void clear();
+
+  /// LEDs of the frame being received. It starts out as a copy of the previous frame.
+  Color *frame() { return this->slot_(this->queued_ + 1); }
+  /// Queue the frame being received for output.
+  void commit();
+  /// Write the frame that is due to the light.
+  void apply(AddressableLight &it);
+
+  uint32_t get_dropped_frames() const { return this->dropped_frames_; }
+  uint32_t get_late_frames() const { return this->late_frames_; }
+
+ protected:
+  /// Frames that arrive up to the delay late are still waiting for their playout, one more is the maximum.
+  uint8_t capacity_() const { return this->depth_ + 1; }
+  /// The frame on the light, the queued frames and the frame being received.
+  uint8_t slot_count_() const { return this->capacity_() + 2; }
+  /// Frame at \p position of the playout order: the frame on the light, the queued frames, the frame being received.
+  Color *slot_(uint8_t position) { return this->frames_ + this->order_[position] * this->size_; }
+  uint32_t delay_() const { return this->depth_ * this->frame_interval_; }
+  void publish_counters_();
+
+  Color *frames_{nullptr};
+  int32_t size_{0};
+  uint32_t frame_interval_{25000};
+  uint8_t depth_{2};
+  bool interpolate_{false};
+
+  /// Frame slots in playout order, see slot_().
+  uint8_t order_[MAX_DEPTH + 3];
+  /// Playout time (in microseconds, minus the delay) of each frame slot.
+  uint32_t timestamps_[MAX_DEPTH + 3];
+  uint8_t queued_{0};
+  bool has_current_{false};
+  bool current_shown_{false};
+  uint8_t last_amount_{0};
+  bool receiving_{false};
+  uint32_t last_commit_{0};
+  uint32_t last_timestamp_{0};
+
+  uint32_t dropped_frames_{0};
+  uint32_t late_frames_{0};
+#ifdef USE_SENSOR
+  sensor::Sensor *dropped_frames_sensor_{nullptr};
+  sensor::Sensor *late_frames_sensor_{nullptr};
+  uint32_t last_publish_{0};
+#endif
+};
+
+}  // namespace light
+}  // namespace esphome
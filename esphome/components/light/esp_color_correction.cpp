@@ -6,6 +6,7 @@ namespace esphome {
 namespace light {
 
 void ESPColorCorrection::calculate_gamma_table(float gamma) {
+  this->tables_valid_ = false;
   for (uint16_t i = 0; i < 256; i++) {
     // corrected = val ^ gamma
     auto corrected = to_uint8_scale(gamma_correct(i / 255.0f, gamma));
@@ -23,5 +24,25 @@ void ESPColorCorrection::calculate_gamma_table(float gamma) {
   }
 }
 
+void ESPColorCorrection::update_tables_() {
+  if (this->tables_valid_)
+    return;
+  if (!this->tables_)
+    this->tables_ = std::unique_ptr<uint8_t[]>(new uint8_t[2 * 4 * 256]);  // NOLINT
+  uint8_t *correct = this->tables_.get();
+  uint8_t *uncorrect = correct + 4 * 256;
+  for (uint16_t i = 0; i < 256; i++) {
+    correct[0 * 256 + i] = this->color_correct_red(i);
+    correct[1 * 256 + i] = this->color_correct_green(i);
+    correct[2 * 256 + i] = this->color_correct_blue(i);
+    correct[3 * 256 + i] = this->color_correct_white(i);
+    uncorrect[0 * 256 + i] = this->color_uncorrect_red(i);
+    uncorrect[1 * 256 + i] = this->color_uncorrect_green(i);
+    uncorrect[2 * 256 + i] = this->color_uncorrect_blue(i);
+    uncorrect[3 * 256 + i] = this->color_uncorrect_white(i);
+  }
+  this->tables_valid_ = true;
+}
+
 }  // namespace light
 }  // namespace esphome
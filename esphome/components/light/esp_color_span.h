@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "esphome/core/color.h"
+
+namespace esphome {
+namespace light {
+
+/// Number of LEDs that bulk operations copy to the stack at once.
+static const int32_t COLOR_SPAN_CHUNK_SIZE = 32;
+
+// Kernels for contiguous arrays of colors. The four channels of a Color are processed at once as one 32-bit word
+// (two channels per 16-bit lane), with the same results as the per-channel Color operators.
+
+/// Same as `Color * scale` on a packed color.
+inline static uint32_t color_word_scale(uint32_t color, uint8_t scale) {
+  const uint32_t factor = uint32_t(scale) + 1;
+  const uint32_t even = (((color & 0x00FF00FFUL) * factor) >> 8) & 0x00FF00FFUL;
+  const uint32_t odd = (((color >> 8) & 0x00FF00FFUL) * factor) & 0xFF00FF00UL;
+  return even | odd;
+}
+
+/// Same as `Color + Color` (saturating per channel) on packed colors.
+inline static uint32_t color_word_add(uint32_t a, uint32_t b) {
+  const uint32_t sum = ((a & 0x7F7F7F7FUL) + (b & 0x7F7F7F7FUL)) ^ ((a ^ b) & 0x80808080UL);
+  const uint32_t carry = ((a & b) | ((a | b) & ~sum)) & 0x80808080UL;
+  return sum | ((carry >> 7) * 0xFF);
+}
+
+inline static void color_span_fill(Color *colors, size_t count, const Color &color) {
+  for (size_t i = 0; i < count; i++)
+    colors[i] = color;
+}
+
+/// Mix \p src into \p dst, \p amnt of 0 keeps dst and 255 replaces it with src.
+inline static void color_span_blend(Color *dst, const Color *src, size_t count, uint8_t amnt) {
+  // the two scaled parts never sum to more than 255, so a plain addition can't carry into the next channel
+  for (size_t i = 0; i < count; i++)
+    dst[i].raw_32 = color_word_scale(dst[i].raw_32, 255 - amnt) + color_word_scale(src[i].raw_32, amnt);
+}
+
+}  // namespace light
+}  // namespace esphome
@@ -7,6 +7,9 @@
 namespace esphome {
 namespace light {
 
+class AddressableLight;
+class ESPRangeView;
+
 class ESPColorSettable {
  public:
   virtual void set(const Color &color) = 0;
@@ -98,6 +101,10 @@ class ESPColorView : public ESPColorSettable {
   }
 
  protected:
+  // the bulk operations access the buffers of lights with a fixed stride directly
+  friend AddressableLight;
+  friend ESPRangeView;
+
   uint8_t *const red_;
   uint8_t *const green_;
   uint8_t *const blue_;
@@ -1,5 +1,8 @@
 #include "esp_range_view.h"
 #include "addressable_light.h"
+#include "esp_color_span.h"
+
+#include <algorithm>
 
 namespace esphome {
 namespace light {
@@ -17,9 +20,44 @@ ESPColorView ESPRangeView::operator[](int32_t index) const {
 ESPRangeIterator ESPRangeView::begin() { return {*this, this->begin_}; }
 ESPRangeIterator ESPRangeView::end() { return {*this, this->end_}; }
 
+/// Apply \p f to the colors of all LEDs in [begin, end), a chunk at a time.
+template<typename F> static void transform_colors(AddressableLight *parent, int32_t begin, int32_t end, F &&f) {
+  Color colors[COLOR_SPAN_CHUNK_SIZE];
+  for (int32_t i = begin; i < end; i += COLOR_SPAN_CHUNK_SIZE) {
+    const int32_t count = std::min(end - i, COLOR_SPAN_CHUNK_SIZE);
+    parent->get_colors(i, colors, count);
+    for (int32_t j = 0; j < count; j++)
+      colors[j] = f(colors[j]);
+    parent->set_colors(i, colors, count);
+  }
+}
+
 void ESPRangeView::set(const Color &color) {
+  const int32_t stride = this->parent_->get_stride_internal();
+  if (stride == 0 || this->size() == 0) {
+    for (int32_t i = this->begin_; i < this->end_; i++) {
+      (*this->parent_)[i] = color;
+    }
+    return;
+  }
+  // all LEDs get the same value, so correct it once and write the raw bytes
+  const Color corrected = this->parent_->correction_.color_correct(color);
+  const ESPColorView first = this->parent_->get_view_internal(this->begin_);
+  uint8_t *red = first.red_;
+  uint8_t *green = first.green_;
+  uint8_t *blue = first.blue_;
+  uint8_t *white = first.white_;
   for (int32_t i = this->begin_; i < this->end_; i++) {
-    (*this->parent_)[i] = color;
+    *red = corrected.red;
+    *green = corrected.green;
+    *blue = corrected.blue;
+    red += stride;
+    green += stride;
+    blue += stride;
+    if (white != nullptr) {
+      *white = corrected.white;
+      white += stride;
+    }
   }
 }
 
@@ -45,20 +83,16 @@ void ESPRangeView::set_effect_data(uint8_t effect_data) {
 }
 
 void ESPRangeView::fade_to_white(uint8_t amnt) {
-  for (auto c : *this)
-    c.fade_to_white(amnt);
+  transform_colors(this->parent_, this->begin_, this->end_, [amnt](Color c) { return c.fade_to_white(amnt); });
 }
 void ESPRangeView::fade_to_black(uint8_t amnt) {
-  for (auto c : *this)
-    c.fade_to_black(amnt);
+  transform_colors(this->parent_, this->begin_, this->end_, [amnt](Color c) { return c.fade_to_black(amnt); });
 }
 void ESPRangeView::lighten(uint8_t delta) {
-  for (auto c : *this)
-    c.lighten(delta);
+  transform_colors(this->parent_, this->begin_, this->end_, [delta](Color c) { return c.lighten(delta); });
 }
 void ESPRangeView::darken(uint8_t delta) {
-  for (auto c : *this)
-    c.darken(delta);
+  transform_colors(this->parent_, this->begin_, this->end_, [delta](Color c) { return c.darken(delta); });
 }
 ESPRangeView &ESPRangeView::operator=(const ESPRangeView &rhs) {  // NOLINT
   // If size doesn't match, error (todo warning)
@@ -72,9 +106,33 @@ ESPRangeView &ESPRangeView::operator=(const ESPRangeView &rhs) {  // NOLINT
   }
 
   // If both equal, already done
-  if (rhs.begin_ == this->begin_)
+  if (rhs.begin_ == this->begin_ || this->size() == 0)
     return *this;
 
+  const int32_t stride = this->parent_->get_stride_internal();
+  if (stride != 0) {
+    // Move the raw bytes within the buffer. This is faster and, unlike a round trip through the color correction,
+    // doesn't lose precision every time an LED is moved.
+    const ESPColorView dst = this->parent_->get_view_internal(this->begin_);
+    const ESPColorView src = this->parent_->get_view_internal(rhs.begin_);
+    uint8_t *const dst_channels[4] = {dst.red_, dst.green_, dst.blue_, dst.white_};
+    const uint8_t *const src_channels[4] = {src.red_, src.green_, src.blue_, src.white_};
+    for (uint8_t c = 0; c < 4; c++) {
+      if (dst_channels[c] == nullptr)
+        continue;
+      if (rhs.begin_ > this->begin_) {
+        // Copy from left
+        for (int32_t i = 0; i < this->size(); i++)
+          dst_channels[c][i * stride] = src_channels[c][i * stride];
+      } else {
+        // Copy from right
+        for (int32_t i = this->size() - 1; i >= 0; i--)
+          dst_channels[c][i * stride] = src_channels[c][i * stride];
+      }
+    }
+    return *this;
+  }
+
   if (rhs.begin_ > this->begin_) {
     // Copy from left
     for (int32_t i = 0; i < this->size(); i++) {
@@ -158,10 +158,10 @@ std::string LightState::get_effect_name() {
   }
 }
 
-void LightState::add_new_remote_values_callback(std::function<void()> &&send_callback) {
+void LightState::add_new_remote_values_callback(Delegate<void()> &&send_callback) {
   this->remote_values_callback_.add(std::move(send_callback));
 }
-void LightState::add_new_target_state_reached_callback(std::function<void()> &&send_callback) {
+void LightState::add_new_target_state_reached_callback(Delegate<void()> &&send_callback) {
   this->target_state_reached_callback_.add(std::move(send_callback));
 }
 
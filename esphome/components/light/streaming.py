@@ -0,0 +1,96 @@
+"""Jitter buffer options of the effects that stream LED data (e131, wled, adalight)."""
+
+import esphome.codegen as cg
+from esphome.components import sensor
+import esphome.config_validation as cv
+from esphome.const import (
+    CONF_EFFECTS,
+    CONF_ID,
+    ENTITY_CATEGORY_DIAGNOSTIC,
+    STATE_CLASS_TOTAL_INCREASING,
+)
+from esphome.core import CORE
+
+from .types import AddressableLightStream
+
+CONF_STREAMING = "streaming"
+CONF_FRAME_RATE = "frame_rate"
+CONF_JITTER_BUFFER = "jitter_buffer"
+CONF_INTERPOLATE = "interpolate"
+CONF_DROPPED_FRAMES = "dropped_frames"
+CONF_LATE_FRAMES = "late_frames"
+
+MAX_JITTER_BUFFER = 8
+_COUNTERS = (CONF_DROPPED_FRAMES, CONF_LATE_FRAMES)
+
+
+def _has_counters(effect_type: str) -> bool:
+    lights = (getattr(CORE, "raw_config", None) or {}).get("light") or []
+    if not isinstance(lights, list):
+        lights = [lights]
+    for light in lights:
+        effects = light.get(CONF_EFFECTS) if isinstance(light, dict) else None
+        for effect in effects or []:
+            conf = effect.get(effect_type) if isinstance(effect, dict) else None
+            streaming = conf.get(CONF_STREAMING) if isinstance(conf, dict) else None
+            if isinstance(streaming, dict) and any(c in streaming for c in _COUNTERS):
+                return True
+    return False
+
+
+def streaming_auto_load(effect_type: str) -> list[str]:
+    """AUTO_LOAD of a streaming effect, the sensor component only if it has counters.
+
+    Integrations are loaded before the light effects are validated, so this looks at
+    the raw configuration.
+    """
+    return ["sensor"] if _has_counters(effect_type) else []
+
+
+def _validate_counters(config):
+    counters = [c for c in _COUNTERS if c in config]
+    if counters and "sensor" not in CORE.loaded_integrations:
+        raise cv.Invalid(f"{counters[0]} requires the sensor component")
+    return config
+
+
+_FRAME_COUNTER_SCHEMA = sensor.sensor_schema(
+    icon="mdi:counter",
+    accuracy_decimals=0,
+    state_class=STATE_CLASS_TOTAL_INCREASING,
+    entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+)
+
+STREAMING_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(AddressableLightStream),
+            # frames per second the sender is expected to send
+            cv.Optional(CONF_FRAME_RATE, default=40): cv.float_range(min=1, max=200),
+            # frames the output is delayed by to absorb jitter
+            cv.Optional(CONF_JITTER_BUFFER, default=2): cv.int_range(
+                min=1, max=MAX_JITTER_BUFFER
+            ),
+            cv.Optional(CONF_INTERPOLATE, default=False): cv.boolean,
+            cv.Optional(CONF_DROPPED_FRAMES): _FRAME_COUNTER_SCHEMA,
+            cv.Optional(CONF_LATE_FRAMES): _FRAME_COUNTER_SCHEMA,
+        }
+    ),
+    _validate_counters,
+)
+
+
+async def setup_streaming(effect, config):
+    if (conf := config.get(CONF_STREAMING)) is None:
+        return
+    stream = cg.new_Pvariable(conf[CONF_ID])
+    cg.add(stream.set_frame_rate(conf[CONF_FRAME_RATE]))
+    cg.add(stream.set_depth(conf[CONF_JITTER_BUFFER]))
+    cg.add(stream.set_interpolate(conf[CONF_INTERPOLATE]))
+    if dropped_config := conf.get(CONF_DROPPED_FRAMES):
+        sens = await sensor.new_sensor(dropped_config)
+        cg.add(stream.set_dropped_frames_sensor(sens))
+    if late_config := conf.get(CONF_LATE_FRAMES):
+        sens = await sensor.new_sensor(late_config)
+        cg.add(stream.set_late_frames_sensor(sens))
+    cg.add(effect.set_stream(stream))
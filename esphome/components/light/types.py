@@ -83,3 +83,5 @@ AddressableFireworksEffect = light_ns.class_(
 AddressableFlickerEffect = light_ns.class_(
     "AddressableFlickerEffect", AddressableLightEffect
 )
+
+AddressableLightStream = light_ns.class_("AddressableLightStream")
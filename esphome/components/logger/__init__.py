@@ -32,6 +32,7 @@ from esphome.const import (
     PLATFORM_BK72XX,
     PLATFORM_ESP32,
     PLATFORM_ESP8266,
+    PLATFORM_HOST,
     PLATFORM_RP2040,
     PLATFORM_RTL87XX,
 )
@@ -170,6 +171,8 @@ LoggerMessageTrigger = logger_ns.class_(
 )
 
 CONF_ESP8266_STORE_LOG_STRINGS_IN_FLASH = "esp8266_store_log_strings_in_flash"
+CONF_TASK_LOG_BUFFER_SIZE = "task_log_buffer_size"
+CONF_BINARY_LOGS = "binary_logs"
 CONFIG_SCHEMA = cv.All(
     cv.Schema(
         {
@@ -216,6 +219,17 @@ CONFIG_SCHEMA = cv.All(
             cv.SplitDefault(
                 CONF_ESP8266_STORE_LOG_STRINGS_IN_FLASH, esp8266=True
             ): cv.All(cv.only_on_esp8266, cv.boolean),
+            # Messages take their formatted length plus a small header, so the
+            # default holds about 15 messages of 100 bytes, more when they are short.
+            cv.SplitDefault(
+                CONF_TASK_LOG_BUFFER_SIZE, esp32="2048B", host="2048B"
+            ): cv.All(
+                cv.only_on([PLATFORM_ESP32, PLATFORM_HOST]),
+                cv.validate_bytes,
+            ),
+            cv.Optional(CONF_BINARY_LOGS, default=False): cv.All(
+                cv.only_on([PLATFORM_ESP32, PLATFORM_HOST]), cv.boolean
+            ),
         }
     ).extend(cv.COMPONENT_SCHEMA),
     validate_local_no_higher_than_global,
@@ -278,6 +292,11 @@ async def to_code(config):
         cg.add_build_flag("-DENABLE_I2C_DEBUG_BUFFER")
     if config.get(CONF_ESP8266_STORE_LOG_STRINGS_IN_FLASH):
         cg.add_build_flag("-DUSE_STORE_LOG_STR_IN_FLASH")
+    if task_log_buffer_size := config.get(CONF_TASK_LOG_BUFFER_SIZE):
+        cg.add_define("USE_LOGGER_TASK_LOG_BUFFER")
+        cg.add(log.init_task_log_buffer(task_log_buffer_size))
+    if config[CONF_BINARY_LOGS]:
+        cg.add_define("USE_LOGGER_BINARY")
 
     if CORE.using_arduino:
         if config[CONF_HARDWARE_UART] == USB_CDC:
@@ -0,0 +1,258 @@
+#include "binary_log.h"
+
+#ifdef USE_LOGGER_BINARY
+
+#include <cstring>
+
+#ifdef USE_ESP32
+#include <soc/soc_memory_layout.h>
+#endif
+
+// Format strings are identified by their offset to this symbol, which binary_log.py looks up in the firmware ELF.
+// Using an offset instead of the address keeps the ids valid for position independent host executables.
+extern "C" {
+extern const char esphome_binary_log_anchor[];
+const char esphome_binary_log_anchor[] = "esphome_binary_log";
+}
+
+#ifdef USE_HOST
+// provided by the GNU linker, everything in between is part of the executable image
+extern "C" char __executable_start;  // NOLINT
+extern "C" char edata;               // NOLINT
+#endif
+
+namespace esphome {
+namespace logger {
+
+namespace {
+
+class RecordWriter {
+ public:
+  RecordWriter(uint8_t *buffer, size_t size) : at_(buffer), end_(buffer + size) {}
+
+  void write_byte(uint8_t value) {
+    if (this->at_ < this->end_) {
+      *this->at_++ = value;
+    } else {
+      this->overflow_ = true;
+    }
+  }
+  void write_varint(uint64_t value) {
+    while (value > 0x7F) {
+      this->write_byte(static_cast<uint8_t>(value | 0x80));
+      value >>= 7;
+    }
+    this->write_byte(static_cast<uint8_t>(value));
+  }
+  void write_zigzag(int64_t value) {
+    this->write_varint((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+  }
+  void write_bytes(const char *data, size_t length) {
+    this->write_varint(length);
+    if (static_cast<size_t>(this->end_ - this->at_) < length) {
+      this->overflow_ = true;
+      return;
+    }
+    memcpy(this->at_, data, length);
+    this->at_ += length;
+  }
+  void write_double(double value) {
+    // length prefixed like strings, so the decoder knows whether a float32 or a float64 follows
+    auto narrow = static_cast<float>(value);
+    if (static_cast<double>(narrow) == value) {
+      uint32_t raw;
+      memcpy(&raw, &narrow, sizeof(raw));
+      this->write_little_endian_(raw, sizeof(raw));
+    } else {
+      uint64_t raw;
+      memcpy(&raw, &value, sizeof(raw));
+      this->write_little_endian_(raw, sizeof(raw));
+    }
+  }
+
+  bool overflow() const { return this->overflow_; }
+  uint8_t *position() const { return this->at_; }
+
+ protected:
+  uint8_t *at_;
+  uint8_t *end_;
+  bool overflow_{false};
+
+  void write_little_endian_(uint64_t raw, uint8_t length) {
+    this->write_byte(length);
+    for (uint8_t i = 0; i < length; i++)
+      this->write_byte(static_cast<uint8_t>(raw >> (i * 8)));
+  }
+};
+
+bool is_in_executable(const char *ptr) {
+#ifdef USE_ESP32
+  return esp_ptr_in_drom(ptr);
+#elif defined(USE_HOST)
+  return ptr >= &__executable_start && ptr < &edata;
+#else
+  return false;
+#endif
+}
+
+}  // namespace
+
+size_t encode_binary_log(uint8_t *buffer, size_t size, int level, const char *tag, int line, const char *format,
+                         va_list args) {
+  if (!is_in_executable(format))
+    return 0;
+
+  RecordWriter writer(buffer, size);
+  writer.write_byte(BINARY_LOG_MARKER);
+  writer.write_byte(static_cast<uint8_t>(level));
+  writer.write_varint(static_cast<uint32_t>(line));
+  writer.write_bytes(tag, strlen(tag));
+  writer.write_zigzag(static_cast<int64_t>(format - esphome_binary_log_anchor));
+
+  // walk the conversions like printf does, but copy the arguments instead of formatting them
+  for (const char *p = format; *p != '\0'; p++) {
+    if (*p != '%')
+      continue;
+    p++;
+    if (*p == '%')
+      continue;
+    while (*p == '-' || *p == '+' || *p == ' ' || *p == '#' || *p == '0')
+      p++;
+    if (*p == '*') {
+      writer.write_zigzag(va_arg(args, int));
+      p++;
+    } else {
+      while (*p >= '0' && *p <= '9')
+        p++;
+    }
+    int precision = -1;
+    if (*p == '.') {
+      p++;
+      if (*p == '*') {
+        precision = va_arg(args, int);
+        writer.write_zigzag(precision);
+        p++;
+      } else {
+        precision = 0;
+        while (*p >= '0' && *p <= '9')
+          precision = precision * 10 + (*p++ - '0');
+      }
+    }
+
+    enum { INT, LONG, LONG_LONG, SIZE, INTMAX, PTRDIFF } length = INT;
+    if (*p == 'h') {
+      // char and short are promoted to int
+      p++;
+      if (*p == 'h')
+        p++;
+    } else if (*p == 'l') {
+      p++;
+      length = LONG;
+      if (*p == 'l') {
+        p++;
+        length = LONG_LONG;
+      }
+    } else if (*p == 'z') {
+      p++;
+      length = SIZE;
+    } else if (*p == 'j') {
+      p++;
+      length = INTMAX;
+    } else if (*p == 't') {
+      p++;
+      length = PTRDIFF;
+    }
+
+    switch (*p) {
+      case 'd':
+      case 'i': {
+        int64_t value;
+        switch (length) {
+          case LONG:
+            value = va_arg(args, long);
+            break;
+          case LONG_LONG:
+            value = va_arg(args, long long);
+            break;
+          case SIZE:
+            value = static_cast<int64_t>(va_arg(args, size_t));
+            break;
+          case INTMAX:
+            value = va_arg(args, intmax_t);
+            break;
+          case PTRDIFF:
+            value = va_arg(args, ptrdiff_t);
+            break;
+          default:
+            value = va_arg(args, int);
+            break;
+        }
+        writer.write_zigzag(value);
+        break;
+      }
+      case 'u':
+      case 'o':
+      case 'x':
+      case 'X':
+      case 'c': {
+        uint64_t value;
+        switch (length) {
+          case LONG:
+            value = va_arg(args, unsigned long);
+            break;
+          case LONG_LONG:
+            value = va_arg(args, unsigned long long);
+            break;
+          case SIZE:
+            value = va_arg(args, size_t);
+            break;
+          case INTMAX:
+            value = va_arg(args, uintmax_t);
+            break;
+          case PTRDIFF:
+            value = static_cast<uint64_t>(va_arg(args, ptrdiff_t));
+            break;
+          default:
+            value = va_arg(args, unsigned int);
+            break;
+        }
+        writer.write_varint(value);
+        break;
+      }
+      case 'p':
+        writer.write_varint(reinterpret_cast<uintptr_t>(va_arg(args, void *)));
+        break;
+      case 'f':
+      case 'F':
+      case 'e':
+      case 'E':
+      case 'g':
+      case 'G':
+        // most values are floats promoted to double, those are sent as float32 and everything else as float64
+        writer.write_double(va_arg(args, double));
+        break;
+      case 's': {
+        const char *value = va_arg(args, const char *);
+        if (value == nullptr)
+          value = "(null)";
+        size_t value_length = precision < 0 ? strlen(value) : strnlen(value, precision);
+        writer.write_bytes(value, value_length);
+        break;
+      }
+      default:
+        // %n, %a, long double and anything else printf would need to do itself
+        return 0;
+    }
+    if (writer.overflow())
+      return 0;
+  }
+
+  if (writer.overflow())
+    return 0;
+  return writer.position() - buffer;
+}
+
+}  // namespace logger
+}  // namespace esphome
+
+#endif  // USE_LOGGER_BINARY
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_LOGGER_BINARY
+
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace logger {
+
+/// First byte of a binary log record. It can't appear in UTF-8 text, so records and text lines can share a transport.
+static const uint8_t BINARY_LOG_MARKER = 0xFF;
+/// Serial lines starting with this character carry a base64 encoded binary log record.
+static const char BINARY_LOG_SERIAL_PREFIX = '\x02';
+
+/** Encode a log message as a binary record instead of formatting it.
+ *
+ * The record holds the level, line and tag, the offset of the format string relative to
+ * `esphome_binary_log_anchor` and the raw arguments: integers as (zigzag) varints, floating point values as float32
+ * (float64 if they aren't exactly representable as float32) and strings with a length prefix. `esphome logs` looks
+ * the format string up in the firmware ELF and formats the message on the host, see logger/binary_log.py.
+ *
+ * Returns the length of the record, or 0 if the message can't be encoded (the format string isn't stored in flash,
+ * uses an unsupported conversion or the record doesn't fit into \p size bytes). Such messages must be sent as text.
+ */
+size_t encode_binary_log(uint8_t *buffer, size_t size, int level, const char *tag, int line, const char *format,
+                         va_list args);
+
+}  // namespace logger
+}  // namespace esphome
+
+#endif  // USE_LOGGER_BINARY
@@ -0,0 +1,227 @@
+"""Reconstruct log messages sent as binary records (logger: binary_logs: true).
+
+The device sends the offset of the format string and the raw arguments instead of the formatted
+message (see binary_log.cpp). The format strings are read from the firmware ELF of the same build.
+"""
+
+from __future__ import annotations
+
+import base64
+import logging
+from pathlib import Path
+import re
+import struct
+
+_LOGGER = logging.getLogger(__name__)
+
+BINARY_LOG_MARKER = 0xFF
+BINARY_LOG_SERIAL_PREFIX = b"\x02"
+ANCHOR_SYMBOL = "esphome_binary_log_anchor"
+
+LEVEL_COLORS = [
+    "",
+    "\033[1;31m",  # ERROR
+    "\033[0;33m",  # WARNING
+    "\033[0;32m",  # INFO
+    "\033[0;35m",  # CONFIG
+    "\033[0;36m",  # DEBUG
+    "\033[0;37m",  # VERBOSE
+    "\033[0;38m",  # VERY_VERBOSE
+]
+LEVEL_LETTERS = ["", "E", "W", "I", "C", "D", "V", "VV"]
+RESET_COLOR = "\033[0m"
+
+# Same grammar as the conversion parser in binary_log.cpp
+CONVERSION_RE = re.compile(
+    r"%(?P<flags>[-+ #0]*)(?P<width>\*|\d+)?(?:\.(?P<precision>\*|\d*))?"
+    r"(?:hh|h|ll|l|z|j|t)?(?P<conversion>[diouxXcpfFeEgGs%])"
+)
+
+SHT_SYMTAB = 2
+SHT_NOBITS = 8
+SHF_ALLOC = 0x2
+
+
+class ElfStrings:
+    """Minimal ELF reader that resolves format string offsets to strings."""
+
+    def __init__(self, path: Path) -> None:
+        data = path.read_bytes()
+        if data[:4] != b"\x7fELF":
+            raise ValueError(f"{path} is not an ELF file")
+        is_64 = data[4] == 2
+        endian = "<" if data[5] == 1 else ">"
+        if is_64:
+            shoff, shentsize, shnum = (
+                struct.unpack_from(f"{endian}Q", data, 0x28)[0],
+                *struct.unpack_from(f"{endian}HH", data, 0x3A),
+            )
+            section_format = f"{endian}IIQQQQIIQQ"
+        else:
+            shoff, shentsize, shnum = (
+                struct.unpack_from(f"{endian}I", data, 0x20)[0],
+                *struct.unpack_from(f"{endian}HH", data, 0x2E),
+            )
+            section_format = f"{endian}IIIIIIIIII"
+
+        sections = [
+            struct.unpack_from(section_format, data, shoff + i * shentsize)
+            for i in range(shnum)
+        ]
+        self._data = data
+        # (address, size, file offset) of all sections loaded into memory
+        self._loaded = [
+            (addr, size, offset)
+            for _, sh_type, flags, addr, offset, size, *_ in sections
+            if flags & SHF_ALLOC and sh_type != SHT_NOBITS and addr != 0
+        ]
+        self.anchor = None
+        for _, sh_type, _, _, offset, size, link, _, _, entsize in sections:
+            if sh_type != SHT_SYMTAB:
+                continue
+            strtab_offset = sections[link][4]
+            for sym_offset in range(offset, offset + size, entsize):
+                if is_64:
+                    name, _, _, _, value, _ = struct.unpack_from(
+                        f"{endian}IBBHQQ", data, sym_offset
+                    )
+                else:
+                    name, value, _, _, _, _ = struct.unpack_from(
+                        f"{endian}IIIBBH", data, sym_offset
+                    )
+                if self._read_cstring(strtab_offset + name) == ANCHOR_SYMBOL:
+                    self.anchor = value
+                    break
+        if self.anchor is None:
+            raise ValueError(f"{path} was not built with binary logs")
+
+    def _read_cstring(self, offset: int) -> str:
+        end = self._data.index(b"\0", offset)
+        return self._data[offset:end].decode("utf8", "backslashreplace")
+
+    def format_string(self, offset: int) -> str | None:
+        address = self.anchor + offset
+        for addr, size, file_offset in self._loaded:
+            if addr <= address < addr + size:
+                return self._read_cstring(file_offset + address - addr)
+        return None
+
+
+class _Reader:
+    def __init__(self, data: bytes) -> None:
+        self.data = data
+        self.pos = 0
+
+    def byte(self) -> int:
+        value = self.data[self.pos]
+        self.pos += 1
+        return value
+
+    def varint(self) -> int:
+        result = 0
+        shift = 0
+        while True:
+            value = self.byte()
+            result |= (value & 0x7F) << shift
+            if not value & 0x80:
+                return result
+            shift += 7
+
+    def zigzag(self) -> int:
+        value = self.varint()
+        return (value >> 1) ^ -(value & 1)
+
+    def bytes(self) -> bytes:
+        length = self.varint()
+        value = self.data[self.pos : self.pos + length]
+        self.pos += length
+        return value
+
+    def float(self) -> float:
+        # float32 or float64, depending on whether the value fits into a float32 exactly
+        length = self.byte()
+        value_format = "<f" if length == 4 else "<d"
+        (value,) = struct.unpack_from(value_format, self.data, self.pos)
+        self.pos += length
+        return value
+
+
+def _format(fmt: str, reader: _Reader) -> str:
+    def replace(match: re.Match) -> str:
+        conversion = match.group("conversion")
+        if conversion == "%":
+            return "%"
+        width = match.group("width") or ""
+        if width == "*":
+            width = str(reader.zigzag())
+        precision = match.group("precision")
+        if precision == "*":
+            precision = str(reader.zigzag())
+        spec = "%" + match.group("flags") + width
+        if precision is not None:
+            spec += "." + precision
+
+        if conversion in "di":
+            return (spec + "d") % reader.zigzag()
+        if conversion in "uoxXc":
+            return (spec + ("d" if conversion == "u" else conversion)) % reader.varint()
+        if conversion == "p":
+            return f"0x{reader.varint():x}"
+        if conversion in "fFeEgG":
+            return (spec + conversion.replace("F", "f")) % reader.float()
+        # %s, the device already applied the precision
+        value = reader.bytes().decode("utf8", "backslashreplace")
+        return ("%" + match.group("flags") + width + "s") % value
+
+    return CONVERSION_RE.sub(replace, fmt)
+
+
+class BinaryLogDecoder:
+    def __init__(self, elf_path: Path) -> None:
+        self.strings = ElfStrings(elf_path)
+
+    def decode(self, record: bytes) -> str:
+        """Format a binary record the same way the logger formats text messages."""
+        reader = _Reader(record)
+        try:
+            reader.byte()  # marker
+            level = min(reader.byte(), len(LEVEL_COLORS) - 1)
+            line = reader.varint()
+            tag = reader.bytes().decode("utf8", "backslashreplace")
+            fmt = self.strings.format_string(reader.zigzag())
+            if fmt is None:
+                text = "<unknown format string, is the firmware up to date?>"
+            else:
+                text = _format(fmt.rstrip("\n"), reader)
+        except (IndexError, struct.error, TypeError, ValueError):
+            return f"<invalid binary log record {record.hex()}>"
+        color = LEVEL_COLORS[level]
+        return f"{color}[{LEVEL_LETTERS[level]}][{tag}:{line:03}]: {text}{RESET_COLOR}"
+
+    def decode_serial_line(self, line: bytes) -> bytes:
+        """Decode serial lines carrying a base64 encoded record, other lines are returned as is."""
+        if not line.startswith(BINARY_LOG_SERIAL_PREFIX):
+            return line
+        try:
+            record = base64.b64decode(line[1:].strip())
+        except ValueError:
+            return line
+        return self.decode(record).encode("utf8")
+
+
+def get_binary_log_decoder(config) -> BinaryLogDecoder | None:
+    """Return a decoder if the configuration uses binary logs and the firmware has been built."""
+    from esphome import platformio_api
+
+    from . import CONF_BINARY_LOGS
+
+    if not config.get("logger", {}).get(CONF_BINARY_LOGS):
+        return None
+    try:
+        elf_path = Path(platformio_api.get_idedata(config).firmware_elf_path)
+        return BinaryLogDecoder(elf_path)
+    except Exception as err:  # pylint: disable=broad-except
+        _LOGGER.warning(
+            "Binary logs can't be decoded, compile the firmware first: %s", err
+        )
+        return None
@@ -59,10 +59,25 @@ void Logger::write_header_(int level, const char *tag, int line) {
 }
 
 void HOT Logger::log_vprintf_(int level, const char *tag, int line, const char *format, va_list args) {  // NOLINT
-  if (level > this->level_for(tag) || recursion_guard_)
+  if (level > this->level_for(tag))
+    return;
+#ifdef USE_LOGGER_TASK_LOG_BUFFER
+  if (this->task_log_buffer_ != nullptr && !this->is_main_task_()) {
+    // never touch tx_buffer_ or the outputs from another task, the main loop writes the message out later
+    this->log_to_task_buffer_(level, tag, line, format, args);
+    return;
+  }
+#endif
+  if (recursion_guard_)
     return;
 
   recursion_guard_ = true;
+#ifdef USE_LOGGER_BINARY
+  if (this->log_binary_(level, tag, line, format, args)) {
+    recursion_guard_ = false;
+    return;
+  }
+#endif
   this->reset_buffer_();
   this->write_header_(level, tag, line);
   this->vprintf_to_buffer_(format, args);
@@ -70,6 +85,58 @@ void HOT Logger::log_vprintf_(int level, const char *tag, int line, const char *
   this->log_message_(level, tag);
   recursion_guard_ = false;
 }
+
+#ifdef USE_LOGGER_BINARY
+bool HOT Logger::log_binary_(int level, const char *tag, int line, const char *format, va_list args) {
+  va_list record_args;
+  va_copy(record_args, args);
+  size_t length =
+      encode_binary_log(this->binary_buffer_, this->binary_buffer_size_, level, tag, line, format, record_args);
+  va_end(record_args);
+  if (length == 0)
+    return false;
+
+  if (this->baud_rate_ > 0) {
+    // serial is line based, send the record as base64 (the buffer size leaves room for that)
+    static const char *const BASE64_CHARS = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    this->reset_buffer_();
+    this->write_to_buffer_(BINARY_LOG_SERIAL_PREFIX);
+    for (size_t i = 0; i < length; i += 3) {
+      uint32_t group = this->binary_buffer_[i] << 16;
+      if (i + 1 < length)
+        group |= this->binary_buffer_[i + 1] << 8;
+      if (i + 2 < length)
+        group |= this->binary_buffer_[i + 2];
+      this->write_to_buffer_(BASE64_CHARS[(group >> 18) & 0x3F]);
+      this->write_to_buffer_(BASE64_CHARS[(group >> 12) & 0x3F]);
+      this->write_to_buffer_(i + 1 < length ? BASE64_CHARS[(group >> 6) & 0x3F] : '=');
+      this->write_to_buffer_(i + 2 < length ? BASE64_CHARS[group & 0x3F] : '=');
+    }
+    this->set_null_terminator_();
+    this->write_msg_(this->tx_buffer_);
+  }
+
+#ifdef USE_ESP32
+  // see call_log_callbacks_()
+  if (xPortGetFreeHeapSize() < 2048)
+    return true;
+#endif
+  this->binary_log_callback_.call(level, tag, reinterpret_cast<const char *>(this->binary_buffer_), length);
+
+  if (this->log_callback_.size() != 0) {
+    // text subscribers (MQTT, web server, on_message triggers) still need the formatted message
+    this->reset_buffer_();
+    this->write_header_(level, tag, line);
+    this->vprintf_to_buffer_(format, args);
+    this->write_footer_();
+    if (this->tx_buffer_[this->tx_buffer_at_ - 1] == '\n')
+      this->tx_buffer_at_--;
+    this->set_null_terminator_();
+    this->log_callback_.call(level, tag, this->tx_buffer_);
+  }
+  return true;
+}
+#endif
 #ifdef USE_STORE_LOG_STR_IN_FLASH
 void Logger::log_vprintf_(int level, const char *tag, int line, const __FlashStringHelper *format,
                           va_list args) {  // NOLINT
@@ -127,6 +194,10 @@ void HOT Logger::log_message_(int level, const char *tag, int offset) {
     this->write_msg_(msg);
   }
 
+  this->call_log_callbacks_(level, tag, msg);
+}
+
+void HOT Logger::call_log_callbacks_(int level, const char *tag, const char *msg) {
 #ifdef USE_ESP32
   // Suppress network-logging if memory constrained, but still log to serial
   // ports. In some configurations (eg BLE enabled) there may be some transient
@@ -138,31 +209,121 @@ void HOT Logger::log_message_(int level, const char *tag, int offset) {
 #endif
 
   this->log_callback_.call(level, tag, msg);
+#ifdef USE_LOGGER_BINARY
+  this->binary_log_callback_.call(level, tag, msg, strlen(msg));
+#endif
 }
 
 Logger::Logger(uint32_t baud_rate, size_t tx_buffer_size) : baud_rate_(baud_rate), tx_buffer_size_(tx_buffer_size) {
   // add 1 to buffer size for null terminator
   this->tx_buffer_ = new char[this->tx_buffer_size_ + 1];  // NOLINT
+#ifdef USE_LOGGER_BINARY
+  // sized so that the base64 encoded record plus prefix still fits into tx_buffer_
+  this->binary_buffer_size_ = (this->tx_buffer_size_ - 1) / 4 * 3;
+  this->binary_buffer_ = new uint8_t[this->binary_buffer_size_];  // NOLINT
+#endif
 #if defined(USE_ESP32) || defined(USE_LIBRETINY)
   this->main_task_ = xTaskGetCurrentTaskHandle();
 #endif
+#if defined(USE_LOGGER_TASK_LOG_BUFFER) && defined(USE_HOST)
+  this->main_thread_ = pthread_self();
+#endif
 }
 
-#ifdef USE_LOGGER_USB_CDC
+#if defined(USE_LOGGER_USB_CDC) || defined(USE_LOGGER_TASK_LOG_BUFFER)
 void Logger::loop() {
-#ifdef USE_ARDUINO
-  if (this->uart_ != UART_SELECTION_USB_CDC) {
+#ifdef USE_LOGGER_TASK_LOG_BUFFER
+  this->process_task_log_buffer_();
+#endif
+#if defined(USE_LOGGER_USB_CDC) && defined(USE_ARDUINO)
+  if (this->uart_ == UART_SELECTION_USB_CDC) {
+    // keep polling for the USB CDC port to open
+    static bool opened = false;
+    if (opened != Serial) {
+      if (false == opened) {
+        App.schedule_dump_config();
+      }
+      opened = !opened;
+    }
     return;
   }
-  static bool opened = false;
-  if (opened == Serial) {
+#endif
+#ifdef USE_LOGGER_TASK_LOG_BUFFER
+  // nothing to do until another task queues a message, log_to_task_buffer_() enables the loop again
+  this->disable_loop();
+#endif
+}
+#endif
+
+#ifdef USE_LOGGER_TASK_LOG_BUFFER
+void Logger::init_task_log_buffer(size_t size) { this->task_log_buffer_ = make_unique<TaskLogBuffer>(size); }
+
+void HOT Logger::log_to_task_buffer_(int level, const char *tag, int line, const char *format, va_list args) {
+  if (level < 0)
+    level = 0;
+  if (level > 7)
+    level = 7;
+  const char *color = LOG_LEVEL_COLORS[level];
+  const char *letter = LOG_LEVEL_LETTERS[level];
+  char thread_name[16] = "";
+#ifdef USE_HOST
+  pthread_getname_np(pthread_self(), thread_name, sizeof(thread_name));
+#elif defined(USE_ESP32)
+  strncpy(thread_name, pcTaskGetName(nullptr), sizeof(thread_name) - 1);
+#endif
+
+  // measure the message first, so that it only takes the room it needs in the buffer
+  va_list measure_args;
+  va_copy(measure_args, args);
+  int body = vsnprintf(nullptr, 0, format, measure_args);
+  va_end(measure_args);
+  int header = snprintf(nullptr, 0, "%s[%s][%s:%03u]%s[%s]%s: ", color, letter, tag, line,
+                        ESPHOME_LOG_BOLD(ESPHOME_LOG_COLOR_RED), thread_name, color);
+  if (body < 0 || header < 0)
     return;
+  // same limit as messages from the main task
+  const size_t length = std::min<size_t>(header + body + strlen(ESPHOME_LOG_RESET_COLOR), this->tx_buffer_size_);
+
+  bool queued = this->task_log_buffer_->push(level, tag, length, [&](char *buffer, size_t size) -> size_t {
+    // same layout as write_header_() and write_footer_() use for messages from other tasks
+    int at = snprintf(buffer, size, "%s[%s][%s:%03u]%s[%s]%s: ", color, letter, tag, line,
+                      ESPHOME_LOG_BOLD(ESPHOME_LOG_COLOR_RED), thread_name, color);
+    if (at < 0)
+      at = 0;
+    if ((size_t) at < size) {
+      int ret = vsnprintf(buffer + at, size - at, format, args);
+      if (ret > 0)
+        at += ret;
+    }
+    if ((size_t) at >= size)
+      at = size - 1;
+    if (at > 0 && buffer[at - 1] == '\n')
+      at--;
+    int ret = snprintf(buffer + at, size - at, "%s", ESPHOME_LOG_RESET_COLOR);
+    if (ret > 0)
+      at = std::min<size_t>(at + ret, size - 1);
+    buffer[at] = '\0';
+    return at;
+  });
+  if (queued)
+    this->enable_loop_soon_any_context();
+}
+
+void Logger::process_task_log_buffer_() {
+  TaskLogBuffer::Message *message;
+  while ((message = this->task_log_buffer_->front()) != nullptr) {
+    if (this->baud_rate_ > 0)
+      this->write_msg_(message->text);
+    this->recursion_guard_ = true;
+    this->call_log_callbacks_(message->level, message->tag, message->text);
+    this->recursion_guard_ = false;
+    this->task_log_buffer_->pop();
   }
-  if (false == opened) {
-    App.schedule_dump_config();
+  const uint32_t dropped = this->task_log_buffer_->take_dropped();
+  if (dropped != 0) {
+    this->task_log_dropped_ += dropped;
+    ESP_LOGW(TAG, "Dropped %" PRIu32 " messages from other tasks, the task log buffer is full", dropped);
   }
-  opened = !opened;
-#endif
 }
 #endif
 
@@ -175,9 +336,14 @@ void Logger::set_log_level(const std::string &tag, int log_level) {
 UARTSelection Logger::get_uart() const { return this->uart_; }
 #endif
 
-void Logger::add_on_log_callback(std::function<void(int, const char *, const char *)> &&callback) {
+void Logger::add_on_log_callback(Delegate<void(int, const char *, const char *)> &&callback) {
   this->log_callback_.add(std::move(callback));
 }
+#ifdef USE_LOGGER_BINARY
+void Logger::add_on_binary_log_callback(Delegate<void(int, const char *, const char *, size_t)> &&callback) {
+  this->binary_log_callback_.add(std::move(callback));
+}
+#endif
 float Logger::get_setup_priority() const { return setup_priority::BUS + 500.0f; }
 const char *const LOG_LEVELS[] = {"NONE", "ERROR", "WARN", "INFO", "CONFIG", "DEBUG", "VERBOSE", "VERY_VERBOSE"};
 
@@ -192,6 +358,14 @@ void Logger::dump_config() {
   for (auto &it : this->log_levels_) {
     ESP_LOGCONFIG(TAG, "  Level for '%s': %s", it.tag.c_str(), LOG_LEVELS[it.level]);
   }
+#ifdef USE_LOGGER_TASK_LOG_BUFFER
+  if (this->task_log_buffer_ != nullptr) {
+    ESP_LOGCONFIG(TAG, "  Task Log Buffer: %u bytes", (unsigned) this->task_log_buffer_->get_size());
+  }
+#endif
+#ifdef USE_LOGGER_BINARY
+  ESP_LOGCONFIG(TAG, "  Binary Logs: YES");
+#endif
 }
 void Logger::write_footer_() { this->write_to_buffer_(ESPHOME_LOG_RESET_COLOR, strlen(ESPHOME_LOG_RESET_COLOR)); }
 
@@ -21,6 +21,17 @@
 #include <driver/uart.h>
 #endif  // USE_ESP_IDF
 
+#ifdef USE_LOGGER_BINARY
+#include "binary_log.h"
+#endif
+
+#ifdef USE_LOGGER_TASK_LOG_BUFFER
+#include "task_log_buffer.h"
+#ifdef USE_HOST
+#include <pthread.h>
+#endif
+#endif  // USE_LOGGER_TASK_LOG_BUFFER
+
 namespace esphome {
 
 namespace logger {
@@ -56,8 +67,15 @@ enum UARTSelection {
 class Logger : public Component {
  public:
   explicit Logger(uint32_t baud_rate, size_t tx_buffer_size);
-#ifdef USE_LOGGER_USB_CDC
+#if defined(USE_LOGGER_USB_CDC) || defined(USE_LOGGER_TASK_LOG_BUFFER)
   void loop() override;
+#endif
+#ifdef USE_LOGGER_TASK_LOG_BUFFER
+  /// Queue messages logged outside the main task in a buffer of \p size bytes (rounded down to a power of two),
+  /// drained by loop().
+  void init_task_log_buffer(size_t size);
+  /// Total number of messages from other tasks that were dropped because the task log buffer was full.
+  uint32_t get_task_log_dropped() const { return this->task_log_dropped_; }
 #endif
   /// Manually set the baud rate for serial, set to 0 to disable.
   void set_baud_rate(uint32_t baud_rate);
@@ -86,7 +104,15 @@ class Logger : public Component {
   int level_for(const char *tag);
 
   /// Register a callback that will be called for every log message sent
-  void add_on_log_callback(std::function<void(int, const char *, const char *)> &&callback);
+  void add_on_log_callback(Delegate<void(int, const char *, const char *)> &&callback);
+#ifdef USE_LOGGER_BINARY
+  /** Register a callback that will be called for every log message sent, without formatting it on the device.
+   *
+   * The message is either a binary record (starting with BINARY_LOG_MARKER) or, for messages that can't be encoded,
+   * the formatted text. It is not null terminated. Text callbacks only cause messages to be formatted if there are any.
+   */
+  void add_on_binary_log_callback(Delegate<void(int, const char *, const char *, size_t)> &&callback);
+#endif
 
   float get_setup_priority() const override;
 
@@ -99,7 +125,22 @@ class Logger : public Component {
   void write_header_(int level, const char *tag, int line);
   void write_footer_();
   void log_message_(int level, const char *tag, int offset = 0);
+  void call_log_callbacks_(int level, const char *tag, const char *msg);
   void write_msg_(const char *msg);
+#ifdef USE_LOGGER_BINARY
+  bool log_binary_(int level, const char *tag, int line, const char *format, va_list args);
+#endif
+#ifdef USE_LOGGER_TASK_LOG_BUFFER
+  inline bool is_main_task_() const {
+#ifdef USE_HOST
+    return pthread_equal(pthread_self(), this->main_thread_);
+#else
+    return xTaskGetCurrentTaskHandle() == this->main_task_;
+#endif
+  }
+  void log_to_task_buffer_(int level, const char *tag, int line, const char *format, va_list args);
+  void process_task_log_buffer_();
+#endif
 
   inline bool is_buffer_full_() const { return this->tx_buffer_at_ >= this->tx_buffer_size_; }
   inline int buffer_remaining_capacity_() const { return this->tx_buffer_size_ - this->tx_buffer_at_; }
@@ -165,9 +206,21 @@ class Logger : public Component {
   };
   std::vector<LogLevelOverride> log_levels_;
   CallbackManager<void(int, const char *, const char *)> log_callback_{};
+#ifdef USE_LOGGER_BINARY
+  CallbackManager<void(int, const char *, const char *, size_t)> binary_log_callback_{};
+  uint8_t *binary_buffer_{nullptr};
+  size_t binary_buffer_size_{0};
+#endif
   /// Prevents recursive log calls, if true a log message is already being processed.
   bool recursion_guard_ = false;
   void *main_task_ = nullptr;
+#ifdef USE_LOGGER_TASK_LOG_BUFFER
+#ifdef USE_HOST
+  pthread_t main_thread_;
+#endif
+  std::unique_ptr<TaskLogBuffer> task_log_buffer_;
+  uint32_t task_log_dropped_{0};
+#endif
 };
 
 extern Logger *global_logger;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
@@ -0,0 +1,76 @@
+#include "task_log_buffer.h"
+
+#ifdef USE_LOGGER_TASK_LOG_BUFFER
+
+#include <cstring>
+
+namespace esphome {
+namespace logger {
+
+TaskLogBuffer::TaskLogBuffer(size_t size) {
+  // positions are mapped into the ring with a mask and may wrap around
+  this->size_ = 1;
+  while (this->size_ * 2 <= size)
+    this->size_ *= 2;
+  // consumed bytes are always zero, so a record reads as unwritten until its producer stores the size
+  this->storage_ = std::unique_ptr<uint8_t[]>(new uint8_t[this->size_]());  // NOLINT
+}
+
+TaskLogBuffer::Record *TaskLogBuffer::acquire_(size_t length) {
+  const uint32_t size = record_size_(length);
+  uint32_t position = this->write_position_.load(std::memory_order_relaxed);
+  uint32_t skip;
+  do {
+    // a record never wraps, the rest of the ring is skipped if it doesn't fit
+    const uint32_t contiguous = this->contiguous_(position);
+    skip = contiguous < size ? contiguous : 0;
+    const uint32_t read_position = this->read_position_.load(std::memory_order_acquire);
+    if (position + skip + size - read_position > this->size_) {
+      this->dropped_.fetch_add(1, std::memory_order_relaxed);
+      return nullptr;
+    }
+  } while (!this->write_position_.compare_exchange_weak(position, position + skip + size, std::memory_order_relaxed));
+
+  if (skip >= sizeof(Record)) {
+    // leave a filler record for the consumer, shorter gaps are skipped without one
+    Record *filler = this->record_(position);
+    filler->message.tag = nullptr;
+    filler->size.store(skip, std::memory_order_release);
+  }
+  return this->record_(position + skip);
+}
+
+TaskLogBuffer::Message *TaskLogBuffer::front() {
+  while (true) {
+    const uint32_t position = this->read_position_.load(std::memory_order_relaxed);
+    if (position == this->write_position_.load(std::memory_order_acquire))
+      return nullptr;
+    const uint32_t contiguous = this->contiguous_(position);
+    if (contiguous < sizeof(Record)) {
+      this->read_position_.store(position + contiguous, std::memory_order_release);
+      continue;
+    }
+    Record *record = this->record_(position);
+    if (record->size.load(std::memory_order_acquire) == 0) {
+      // the producer that reserved this record is still writing it
+      return nullptr;
+    }
+    if (record->message.tag != nullptr)
+      return &record->message;
+    this->pop();
+  }
+}
+
+void TaskLogBuffer::pop() {
+  const uint32_t position = this->read_position_.load(std::memory_order_relaxed);
+  Record *record = this->record_(position);
+  const uint32_t size = record->size.load(std::memory_order_relaxed);
+  memset(static_cast<void *>(record), 0, size);
+  // hand the bytes back to producers
+  this->read_position_.store(position + size, std::memory_order_release);
+}
+
+}  // namespace logger
+}  // namespace esphome
+
+#endif  // USE_LOGGER_TASK_LOG_BUFFER
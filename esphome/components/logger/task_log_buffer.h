@@ -0,0 +1,91 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_LOGGER_TASK_LOG_BUFFER
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace esphome {
+namespace logger {
+
+/** Lock-free multi-producer, single-consumer byte ring of formatted log messages.
+ *
+ * Any task can push messages without taking a lock, only the main loop pops them. Messages are stored back to back
+ * with their exact length, so a short message only takes the room it needs. A producer reserves its record by
+ * advancing the write position, formats the text in place and then publishes the record by storing its size in the
+ * header. When there's not enough room the message is dropped and counted instead of blocking the logging task.
+ */
+class TaskLogBuffer {
+ public:
+  struct Message {
+    /// Log tags are string literals, so the pointer stays valid until the message is drained.
+    const char *tag;
+    uint8_t level;
+    uint16_t length;
+    char *text;
+  };
+
+  /// \p size is rounded down to a power of two.
+  explicit TaskLogBuffer(size_t size);
+
+  /** Queue a message of \p length bytes (excluding the null terminator).
+   *
+   * \p format is called as `size_t format(char *buffer, size_t size)` with room for length + 1 bytes, it writes the
+   * text straight into the buffer and returns the length actually written. Returns false if the buffer was full and
+   * the message got dropped.
+   */
+  template<typename F> bool push(uint8_t level, const char *tag, size_t length, F &&format) {
+    Record *record = this->acquire_(length);
+    if (record == nullptr)
+      return false;
+    record->message.level = level;
+    record->message.tag = tag;
+    record->message.text = reinterpret_cast<char *>(record + 1);
+    record->message.length = format(record->message.text, length + 1);
+    // publish the record to the consumer
+    record->size.store(record_size_(length), std::memory_order_release);
+    return true;
+  }
+
+  /// Oldest queued message, or nullptr if there is none. Only to be called from the consumer.
+  Message *front();
+  /// Release the message returned by front(). Only to be called from the consumer.
+  void pop();
+
+  /// Number of messages dropped since the last call.
+  uint32_t take_dropped() { return this->dropped_.exchange(0, std::memory_order_relaxed); }
+  size_t get_size() const { return this->size_; }
+
+ protected:
+  struct Record {
+    /// Bytes taken by this record including padding, 0 until the producer has written it.
+    std::atomic<uint32_t> size;
+    /// nullptr tag marks the filler at the end of the ring that a record didn't fit in.
+    Message message;
+  };
+
+  static uint32_t record_size_(size_t length) {
+    return (sizeof(Record) + length + 1 + alignof(Record) - 1) / alignof(Record) * alignof(Record);
+  }
+  Record *acquire_(size_t length);
+  Record *record_(uint32_t position) {
+    return reinterpret_cast<Record *>(&this->storage_[position & (this->size_ - 1)]);
+  }
+  /// Bytes left before the end of the ring at \p position.
+  uint32_t contiguous_(uint32_t position) const { return this->size_ - (position & (this->size_ - 1)); }
+
+  std::unique_ptr<uint8_t[]> storage_;
+  uint32_t size_;
+  std::atomic<uint32_t> write_position_{0};
+  std::atomic<uint32_t> read_position_{0};
+  std::atomic<uint32_t> dropped_{0};
+};
+
+}  // namespace logger
+}  // namespace esphome
+
+#endif  // USE_LOGGER_TASK_LOG_BUFFER
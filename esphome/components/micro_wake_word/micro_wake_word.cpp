@@ -14,6 +14,7 @@
 #include <tensorflow/lite/micro/micro_interpreter.h>
 #include <tensorflow/lite/micro/micro_mutable_op_resolver.h>
 
+#include <algorithm>
 #include <cmath>
 
 namespace esphome {
@@ -197,36 +198,38 @@ void MicroWakeWord::set_state_(State state) {
 }
 
 size_t MicroWakeWord::read_microphone_() {
-  size_t bytes_read = this->microphone_->read(this->input_buffer_, INPUT_BUFFER_SIZE * sizeof(int16_t));
-  if (bytes_read == 0) {
-    return 0;
-  }
-
   size_t bytes_free = this->ring_buffer_->free();
 
-  if (bytes_free < bytes_read) {
+  if (bytes_free < INPUT_BUFFER_SIZE * sizeof(int16_t)) {
     ESP_LOGW(TAG,
              "Not enough free bytes in ring buffer to store incoming audio data (free bytes=%d, incoming bytes=%d). "
              "Resetting the ring buffer. Wake word detection accuracy will be reduced.",
-             bytes_free, bytes_read);
+             bytes_free, INPUT_BUFFER_SIZE * sizeof(int16_t));
 
     this->ring_buffer_->reset();
   }
 
-  return this->ring_buffer_->write((void *) this->input_buffer_, bytes_read);
+  // Read straight into the ring buffer, the free space may be split in two where it wraps around
+  size_t bytes_read = 0;
+  while (bytes_read < INPUT_BUFFER_SIZE * sizeof(int16_t)) {
+    size_t span;
+    uint8_t *dst = this->ring_buffer_->acquire_write(&span);
+    span = std::min(span, INPUT_BUFFER_SIZE * sizeof(int16_t) - bytes_read) & ~(sizeof(int16_t) - 1);
+    if (span == 0)
+      break;
+    size_t len = this->microphone_->read(reinterpret_cast<int16_t *>(dst), span);
+    this->ring_buffer_->commit(len);
+    bytes_read += len;
+    if (len < span)
+      break;
+  }
+
+  return bytes_read;
 }
 
 bool MicroWakeWord::allocate_buffers_() {
   ExternalRAMAllocator<int16_t> audio_samples_allocator(ExternalRAMAllocator<int16_t>::ALLOW_FAILURE);
 
-  if (this->input_buffer_ == nullptr) {
-    this->input_buffer_ = audio_samples_allocator.allocate(INPUT_BUFFER_SIZE * sizeof(int16_t));
-    if (this->input_buffer_ == nullptr) {
-      ESP_LOGE(TAG, "Could not allocate input buffer");
-      return false;
-    }
-  }
-
   if (this->preprocessor_audio_buffer_ == nullptr) {
     this->preprocessor_audio_buffer_ = audio_samples_allocator.allocate(this->new_samples_to_get_());
     if (this->preprocessor_audio_buffer_ == nullptr) {
@@ -248,8 +251,6 @@ bool MicroWakeWord::allocate_buffers_() {
 
 void MicroWakeWord::deallocate_buffers_() {
   ExternalRAMAllocator<int16_t> audio_samples_allocator(ExternalRAMAllocator<int16_t>::ALLOW_FAILURE);
-  audio_samples_allocator.deallocate(this->input_buffer_, INPUT_BUFFER_SIZE * sizeof(int16_t));
-  this->input_buffer_ = nullptr;
   audio_samples_allocator.deallocate(this->preprocessor_audio_buffer_, this->new_samples_to_get_());
   this->preprocessor_audio_buffer_ = nullptr;
 }
@@ -348,8 +349,19 @@ bool MicroWakeWord::generate_features_for_window_(int8_t features[PREPROCESSOR_F
     return false;
   }
 
-  size_t bytes_read = this->ring_buffer_->read((void *) (this->preprocessor_audio_buffer_),
-                                               this->new_samples_to_get_() * sizeof(int16_t), pdMS_TO_TICKS(200));
+  const size_t bytes_needed = this->new_samples_to_get_() * sizeof(int16_t);
+  size_t span;
+  const uint8_t *samples = this->ring_buffer_->peek(&span);
+  const int16_t *audio = this->preprocessor_audio_buffer_;
+  size_t bytes_read;
+  if (span >= bytes_needed && reinterpret_cast<uintptr_t>(samples) % alignof(int16_t) == 0) {
+    // The window is contiguous in the ring buffer, process it in place
+    audio = reinterpret_cast<const int16_t *>(samples);
+    bytes_read = bytes_needed;
+  } else {
+    bytes_read =
+        this->ring_buffer_->read((void *) (this->preprocessor_audio_buffer_), bytes_needed, pdMS_TO_TICKS(200));
+  }
 
   if (bytes_read == 0) {
     ESP_LOGE(TAG, "Could not read data from Ring Buffer");
@@ -361,8 +373,10 @@ bool MicroWakeWord::generate_features_for_window_(int8_t features[PREPROCESSOR_F
   }
 
   size_t num_samples_read;
-  struct FrontendOutput frontend_output = FrontendProcessSamples(
-      &this->frontend_state_, this->preprocessor_audio_buffer_, this->new_samples_to_get_(), &num_samples_read);
+  struct FrontendOutput frontend_output =
+      FrontendProcessSamples(&this->frontend_state_, audio, this->new_samples_to_get_(), &num_samples_read);
+  if (audio != this->preprocessor_audio_buffer_)
+    this->ring_buffer_->consume(bytes_needed);
 
   for (size_t i = 0; i < frontend_output.size; ++i) {
     // These scaling values are set to match the TFLite audio frontend int8 output.
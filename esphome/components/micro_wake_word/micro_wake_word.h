@@ -84,8 +84,6 @@ class MicroWakeWord : public Component {
 
   uint8_t features_step_size_;
 
-  // Stores audio read from the microphone before being added to the ring buffer.
-  int16_t *input_buffer_{nullptr};
   // Stores audio to be fed into the audio frontend for generating features.
   int16_t *preprocessor_audio_buffer_{nullptr};
 
@@ -100,18 +98,18 @@ class MicroWakeWord : public Component {
 
   /** Reads audio from microphone into the ring buffer
    *
-   * Audio data (16000 kHz with int16 samples) is read into the input_buffer_.
-   * Verifies the ring buffer has enough space for all audio data. If not, it logs
+   * Audio data (16000 kHz with int16 samples) is read directly into the ring buffer's free space.
+   * Verifies the ring buffer has enough space for a full read. If not, it logs
    * a warning and resets the ring buffer entirely.
    * @return Number of bytes written to the ring buffer
    */
   size_t read_microphone_();
 
-  /// @brief Allocates memory for input_buffer_, preprocessor_audio_buffer_, and ring_buffer_
+  /// @brief Allocates memory for preprocessor_audio_buffer_ and ring_buffer_
   /// @return True if successful, false otherwise
   bool allocate_buffers_();
 
-  /// @brief Frees memory allocated for input_buffer_ and preprocessor_audio_buffer_
+  /// @brief Frees memory allocated for preprocessor_audio_buffer_
   void deallocate_buffers_();
 
   /// @brief Loads streaming models and prepares the feature generation frontend
@@ -2,15 +2,39 @@
 #include "esphome/core/log.h"
 #include "esphome/core/helpers.h"
 
+#include <algorithm>
+#include <cinttypes>
+
 namespace esphome {
 namespace modbus {
 
 static const char *const TAG = "modbus";
 
+static const uint32_t BUS_UTILIZATION_INTERVAL = 60000;
+/// Longest a device that didn't respond is skipped, in multiples of send_wait_time_.
+static const uint8_t MAX_TIMEOUT_BACKOFF = 4;
+
 void Modbus::setup() {
   if (this->flow_control_pin_ != nullptr) {
     this->flow_control_pin_->setup();
   }
+
+  uint32_t baud_rate = this->parent_->get_baud_rate();
+  if (baud_rate > 0) {
+    // start bit, data bits, parity and stop bits
+    uint32_t bits = 1 + this->parent_->get_data_bits() + this->parent_->get_stop_bits() +
+                    (this->parent_->get_parity() != uart::UART_CONFIG_PARITY_NONE ? 1 : 0);
+    this->char_time_ = (bits * 1000000 + baud_rate - 1) / baud_rate;
+  }
+  // the spec fixes the silence at 1750 µs above 19200 baud, where 3.5 characters are shorter
+  this->frame_delay_ = std::max<uint32_t>(this->char_time_ * 7 / 2, 1750);
+
+#ifdef USE_SENSOR
+  if (this->bus_utilization_sensor_ != nullptr) {
+    this->bus_utilization_start_ = millis();
+    this->set_interval("bus_utilization", BUS_UTILIZATION_INTERVAL, [this]() { this->publish_bus_utilization_(); });
+  }
+#endif
 }
 void Modbus::loop() {
   const uint32_t now = millis();
@@ -21,18 +45,86 @@ void Modbus::loop() {
   }
   // stop blocking new send commands after send_wait_time_ ms regardless if a response has been received since then
   if (now - this->last_send_ > send_wait_time_) {
+    if (waiting_for_response != 0)
+      this->on_response_timeout_(waiting_for_response);
     waiting_for_response = 0;
   }
 
+  size_t received = 0;
   while (this->available()) {
     uint8_t byte;
     this->read_byte(&byte);
+    received++;
     if (this->parse_modbus_byte_(byte)) {
       this->last_modbus_byte_ = now;
     } else {
       this->rx_buffer_.clear();
     }
   }
+  if (received > 0)
+    this->mark_bus_activity_(received);
+
+  if (this->role == ModbusRole::CLIENT)
+    this->send_next_request_();
+}
+
+void Modbus::send_next_request_() {
+  if (waiting_for_response != 0) {
+    // read the response as soon as it arrives instead of in the next regular loop
+    this->high_freq_.start();
+    return;
+  }
+  if (micros() - this->last_bus_activity_ < this->frame_delay_) {
+    this->high_freq_.start();
+    return;
+  }
+
+  const uint32_t now = millis();
+  const size_t count = this->devices_.size();
+  for (size_t i = 0; i < count; i++) {
+    const size_t index = (this->next_device_ + i) % count;
+    auto *device = this->devices_[index];
+    if (device->timeouts_ != 0 && static_cast<int32_t>(device->skip_until_ - now) > 0)
+      continue;
+    if (device->send_next_request()) {
+      // round robin, so a device with many requests doesn't delay the others
+      this->next_device_ = index + 1;
+      this->high_freq_.start();
+      return;
+    }
+  }
+  this->high_freq_.stop();
+}
+
+void Modbus::on_response_timeout_(uint8_t address) {
+  for (auto *device : this->devices_) {
+    if (device->address_ != address)
+      continue;
+    if (device->timeouts_ < MAX_TIMEOUT_BACKOFF)
+      device->timeouts_++;
+    // the other devices get the bus while this one is skipped, longer with every timeout in a row
+    device->skip_until_ = millis() + uint32_t(this->send_wait_time_) * device->timeouts_;
+    ESP_LOGV(TAG, "No response from device 0x%02X (%u in a row)", address, device->timeouts_);
+  }
+}
+
+void Modbus::mark_bus_activity_(size_t bytes) {
+  this->bus_chars_ += bytes;
+  this->last_bus_activity_ = micros();
+}
+
+void Modbus::publish_bus_utilization_() {
+#ifdef USE_SENSOR
+  const uint32_t now = millis();
+  const uint32_t elapsed = now - this->bus_utilization_start_;
+  if (elapsed == 0)
+    return;
+  // time the bus carried characters in percent of the time since the last publish, in µs / (ms * 10)
+  float utilization = float(this->bus_chars_) * float(this->char_time_) / (float(elapsed) * 10.0f);
+  this->bus_utilization_sensor_->publish_state(std::min(utilization, 100.0f));
+  this->bus_chars_ = 0;
+  this->bus_utilization_start_ = now;
+#endif
 }
 
 bool Modbus::parse_modbus_byte_(uint8_t byte) {
@@ -120,6 +212,7 @@ bool Modbus::parse_modbus_byte_(uint8_t byte) {
   bool found = false;
   for (auto *device : this->devices_) {
     if (device->address_ == address) {
+      device->timeouts_ = 0;
       // Is it an error response?
       if ((function_code & 0x80) == 0x80) {
         ESP_LOGD(TAG, "Modbus error function code: 0x%X exception: %d", function_code, raw[2]);
@@ -152,6 +245,10 @@ void Modbus::dump_config() {
   ESP_LOGCONFIG(TAG, "Modbus:");
   LOG_PIN("  Flow Control Pin: ", this->flow_control_pin_);
   ESP_LOGCONFIG(TAG, "  Send Wait Time: %d ms", this->send_wait_time_);
+  ESP_LOGCONFIG(TAG, "  Frame Delay: %" PRIu32 " us", this->frame_delay_);
+#ifdef USE_SENSOR
+  LOG_SENSOR("  ", "Bus Utilization", this->bus_utilization_sensor_);
+#endif
   ESP_LOGCONFIG(TAG, "  CRC Disabled: %s", YESNO(this->disable_crc_));
 }
 float Modbus::get_setup_priority() const {
@@ -202,6 +299,7 @@ void Modbus::send(uint8_t address, uint8_t function_code, uint16_t start_address
 
   this->write_array(data);
   this->flush();
+  this->mark_bus_activity_(data.size());
 
   if (this->flow_control_pin_ != nullptr)
     this->flow_control_pin_->digital_write(false);
@@ -225,6 +323,7 @@ void Modbus::send_raw(const std::vector<uint8_t> &payload) {
   this->write_byte(crc & 0xFF);
   this->write_byte((crc >> 8) & 0xFF);
   this->flush();
+  this->mark_bus_activity_(payload.size() + 2);
   if (this->flow_control_pin_ != nullptr)
     this->flow_control_pin_->digital_write(false);
   waiting_for_response = payload[0];
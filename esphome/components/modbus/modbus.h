@@ -1,7 +1,12 @@
 #pragma once
 
 #include "esphome/core/component.h"
+#include "esphome/core/defines.h"
+#include "esphome/core/helpers.h"
 #include "esphome/components/uart/uart.h"
+#ifdef USE_SENSOR
+#include "esphome/components/sensor/sensor.h"
+#endif
 
 #include <vector>
 
@@ -15,6 +20,12 @@ enum ModbusRole {
 
 class ModbusDevice;
 
+/** Modbus RTU bus shared by one or more devices.
+ *
+ * As a client the bus schedules the requests of its devices: whenever no response is pending and the 3.5 character
+ * silence required between frames has passed, the next device in turn that has a request sends it. A device that
+ * doesn't respond is skipped for a while, so it doesn't block the requests to the others.
+ */
 class Modbus : public uart::UARTDevice, public Component {
  public:
   Modbus() = default;
@@ -37,6 +48,9 @@ class Modbus : public uart::UARTDevice, public Component {
   uint8_t waiting_for_response{0};
   void set_send_wait_time(uint16_t time_in_ms) { send_wait_time_ = time_in_ms; }
   void set_disable_crc(bool disable_crc) { disable_crc_ = disable_crc; }
+#ifdef USE_SENSOR
+  SUB_SENSOR(bus_utilization)
+#endif
 
   ModbusRole role;
 
@@ -44,12 +58,30 @@ class Modbus : public uart::UARTDevice, public Component {
   GPIOPin *flow_control_pin_{nullptr};
 
   bool parse_modbus_byte_(uint8_t byte);
+  /// Let the next device in turn send a request, if the bus is free.
+  void send_next_request_();
+  /// Called when the device at \p address didn't respond within send_wait_time_.
+  void on_response_timeout_(uint8_t address);
+  /// Remember when the last frame was sent or received, for the silence between frames.
+  void mark_bus_activity_(size_t bytes);
+  void publish_bus_utilization_();
   uint16_t send_wait_time_{250};
   bool disable_crc_;
   std::vector<uint8_t> rx_buffer_;
   uint32_t last_modbus_byte_{0};
   uint32_t last_send_{0};
   std::vector<ModbusDevice *> devices_;
+  /// Index of the device that gets the first chance to send the next request.
+  size_t next_device_{0};
+  /// Duration of a character in µs, from the UART settings.
+  uint32_t char_time_{0};
+  /// Silence required between two frames in µs: 3.5 characters, at least 1750 µs.
+  uint32_t frame_delay_{0};
+  uint32_t last_bus_activity_{0};
+  /// Characters sent and received since the bus utilization was last published.
+  uint32_t bus_chars_{0};
+  uint32_t bus_utilization_start_{0};
+  HighFrequencyLoopRequester high_freq_;
 };
 
 class ModbusDevice {
@@ -66,12 +98,18 @@ class ModbusDevice {
   void send_raw(const std::vector<uint8_t> &payload) { this->parent_->send_raw(payload); }
   // If more than one device is connected block sending a new command before a response is received
   bool waiting_for_response() { return parent_->waiting_for_response != 0; }
+  /// Called by the bus when it is this device's turn. Send the next request, if any, and return whether one was sent.
+  virtual bool send_next_request() { return false; }
 
  protected:
   friend Modbus;
 
   Modbus *parent_;
   uint8_t address_;
+  /// Consecutive requests without a response.
+  uint8_t timeouts_{0};
+  /// The bus skips this device until this time (millis) after it didn't respond.
+  uint32_t skip_until_{0};
 };
 
 }  // namespace modbus
@@ -0,0 +1,34 @@
+import esphome.codegen as cg
+from esphome.components import sensor
+import esphome.config_validation as cv
+from esphome.const import (
+    ENTITY_CATEGORY_DIAGNOSTIC,
+    ICON_PERCENT,
+    STATE_CLASS_MEASUREMENT,
+    UNIT_PERCENT,
+)
+from . import CONF_MODBUS_ID, Modbus
+
+DEPENDENCIES = ["modbus"]
+
+CONF_BUS_UTILIZATION = "bus_utilization"
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(CONF_MODBUS_ID): cv.use_id(Modbus),
+        cv.Optional(CONF_BUS_UTILIZATION): sensor.sensor_schema(
+            unit_of_measurement=UNIT_PERCENT,
+            accuracy_decimals=1,
+            state_class=STATE_CLASS_MEASUREMENT,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+            icon=ICON_PERCENT,
+        ),
+    }
+)
+
+
+async def to_code(config):
+    hub = await cg.get_variable(config[CONF_MODBUS_ID])
+    if bus_utilization_config := config.get(CONF_BUS_UTILIZATION):
+        sens = await sensor.new_sensor(bus_utilization_config)
+        cg.add(hub.set_bus_utilization_sensor(sens))
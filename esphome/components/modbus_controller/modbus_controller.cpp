@@ -7,16 +7,24 @@ namespace modbus_controller {
 
 static const char *const TAG = "modbus_controller";
 
-void ModbusController::setup() { this->create_register_ranges_(); }
+// SensorItem::offset is a byte, for coils it is the number of the coil in the range
+static const uint16_t MAX_RANGE_COILS = 256;
+
+void ModbusController::setup() {
+  this->create_register_ranges_();
+  this->schedule_register_ranges_();
+}
 
 /*
  To work with the existing modbus class and avoid polling for responses a command queue is used.
  send_next_command will submit the command at the top of the queue and set the corresponding callback
  to handle the response from the device.
- Once the response has been processed it is removed from the queue and the next command is sent
+ Once the response has been processed it is removed from the queue and the next command is sent.
+ The modbus bus calls send_next_command when the bus is free and it is this device's turn.
 */
 bool ModbusController::send_next_command_() {
   uint32_t last_send = millis() - this->last_command_timestamp_;
+  bool sent = false;
 
   if ((last_send > this->command_throttle_) && !waiting_for_response() && !command_queue_.empty()) {
     auto &command = command_queue_.front();
@@ -38,11 +46,13 @@ bool ModbusController::send_next_command_() {
           TAG,
           "Modbus command to device=%d register=0x%02X countdown=%d no response received - removed from send queue",
           this->address_, command->register_address, command->send_countdown);
+      this->release_command_(std::move(command));
       command_queue_.pop_front();
     } else {
       ESP_LOGV(TAG, "Sending next modbus command to device %d register 0x%02X count %d", this->address_,
                command->register_address, command->register_count);
       command->send();
+      sent = true;
 
       this->last_command_timestamp_ = millis();
 
@@ -50,11 +60,12 @@ bool ModbusController::send_next_command_() {
 
       // remove from queue if no handler is defined
       if (!command->on_data_func) {
+        this->release_command_(std::move(command));
         command_queue_.pop_front();
       }
     }
   }
-  return (!command_queue_.empty());
+  return sent;
 }
 
 // Queue incoming response
@@ -68,6 +79,7 @@ void ModbusController::on_modbus_data(const std::vector<uint8_t> &data) {
         // Restore skip_updates_counter to restore commands updates
         for (auto &r : this->register_ranges_) {
           r.skip_updates_counter = 0;
+          r.phase_pending = true;
         }
       }
     }
@@ -99,6 +111,7 @@ void ModbusController::on_modbus_error(uint8_t function_code, uint8_t exception_
              "payload size=%zu",
              function_code, current_command->register_address, current_command->register_count,
              current_command->payload.size());
+    this->release_command_(std::move(current_command));
     command_queue_.pop_front();
   }
 }
@@ -149,7 +162,9 @@ void ModbusController::on_modbus_read_registers(uint8_t function_code, uint16_t
   this->send(function_code, start_address, number_of_registers, response.size(), response.data());
 }
 
-SensorSet ModbusController::find_sensors_(ModbusRegisterType register_type, uint16_t start_address) const {
+const SensorSet &ModbusController::find_sensors_(ModbusRegisterType register_type, uint16_t start_address) const {
+  static const SensorSet EMPTY_SENSOR_SET;
+
   auto reg_it = find_if(begin(register_ranges_), end(register_ranges_), [=](RegisterRange const &r) {
     return (r.start_address == start_address && r.register_type == register_type);
   });
@@ -161,14 +176,14 @@ SensorSet ModbusController::find_sensors_(ModbusRegisterType register_type, uint
   }
 
   // not found
-  return {};
+  return EMPTY_SENSOR_SET;
 }
 void ModbusController::on_register_data(ModbusRegisterType register_type, uint16_t start_address,
                                         const std::vector<uint8_t> &data) {
   ESP_LOGV(TAG, "data for register address : 0x%X : ", start_address);
 
   // loop through all sensors with the same start address
-  auto sensors = find_sensors_(register_type, start_address);
+  const auto &sensors = find_sensors_(register_type, start_address);
   for (auto *sensor : sensors) {
     sensor->parse_and_publish(data);
   }
@@ -187,7 +202,23 @@ void ModbusController::queue_command(const ModbusCommandItem &command) {
       return;
     }
   }
-  command_queue_.push_back(make_unique<ModbusCommandItem>(command));
+  // copying into a pooled command reuses the memory of its payload
+  auto item = this->allocate_command_();
+  *item = command;
+  command_queue_.push_back(std::move(item));
+}
+
+std::unique_ptr<ModbusCommandItem> ModbusController::allocate_command_() {
+  if (this->command_pool_.empty())
+    return make_unique<ModbusCommandItem>();
+  auto command = std::move(this->command_pool_.back());
+  this->command_pool_.pop_back();
+  return command;
+}
+
+void ModbusController::release_command_(std::unique_ptr<ModbusCommandItem> &&command) {
+  if (command != nullptr)
+    this->command_pool_.push_back(std::move(command));
 }
 
 void ModbusController::update_range_(RegisterRange &r) {
@@ -196,7 +227,7 @@ void ModbusController::update_range_(RegisterRange &r) {
   if (r.skip_updates_counter == 0) {
     // if a custom command is used the user supplied custom_data is only available in the SensorItem.
     if (r.register_type == ModbusRegisterType::CUSTOM) {
-      auto sensors = this->find_sensors_(r.register_type, r.start_address);
+      const auto &sensors = this->find_sensors_(r.register_type, r.start_address);
       if (!sensors.empty()) {
         auto sensor = sensors.cbegin();
         auto command_item = ModbusCommandItem::create_custom_command(
@@ -212,7 +243,12 @@ void ModbusController::update_range_(RegisterRange &r) {
     } else {
       queue_command(ModbusCommandItem::create_read_command(this, r.register_type, r.start_address, r.register_count));
     }
-    r.skip_updates_counter = r.skip_updates;  // reset counter to config value
+    if (r.phase_pending) {
+      r.skip_updates_counter = r.skip_updates_phase;
+      r.phase_pending = false;
+    } else {
+      r.skip_updates_counter = r.skip_updates;  // reset counter to config value
+    }
   } else {
     r.skip_updates_counter--;
   }
@@ -269,6 +305,11 @@ size_t ModbusController::create_register_ranges_() {
       // to reuse the last register or extend the current range
       if (!curr->force_new_range && r.register_type == curr->register_type &&
           curr->register_type != ModbusRegisterType::CUSTOM) {
+        const bool is_coil =
+            r.register_type == ModbusRegisterType::COIL || r.register_type == ModbusRegisterType::DISCRETE_INPUT;
+        const uint16_t max_count = is_coil ? MAX_RANGE_COILS : this->max_read_registers_;
+        const uint32_t range_end = r.start_address + r.register_count;
+        const uint32_t new_count = curr->start_address + curr->register_count - r.start_address;
         if (curr->start_address == (r.start_address + r.register_count - prev->register_count) &&
             curr->register_count == prev->register_count && curr->get_register_size() == prev->get_register_size()) {
           // this register can re-use the data from the previous register
@@ -285,7 +326,7 @@ size_t ModbusController::create_register_ranges_() {
 
           ESP_LOGV(TAG, "Re-use previous register - change to register: 0x%X %d offset=%u", curr->start_address,
                    curr->register_count, curr->offset);
-        } else if (curr->start_address == (r.start_address + r.register_count)) {
+        } else if (curr->start_address == range_end && new_count <= max_count) {
           // this register can extend the current range
 
           // remove this sensore because start_address is changed (sort-order)
@@ -302,6 +343,28 @@ size_t ModbusController::create_register_ranges_() {
 
           ESP_LOGV(TAG, "Extend range - change to register: 0x%X %d offset=%u", curr->start_address,
                    curr->register_count, curr->offset);
+        } else if (curr->start_address > range_end && curr->start_address - range_end <= this->max_register_gap_ &&
+                   new_count <= max_count && curr->skip_updates == r.skip_updates && curr->response_bytes == 0 &&
+                   prev->response_bytes == 0) {
+          // reading the unused registers in between is cheaper than another command.
+          // Only registers polled at the same rate are joined, a slow register isn't read more often this way.
+          uint16_t gap = curr->start_address - range_end;
+
+          // remove this sensor because start_address is changed (sort-order)
+          ix = sensorset_.erase(ix);
+
+          curr->start_address = r.start_address;
+          buffer_offset += is_coil ? gap : gap * 2;
+          curr->offset += buffer_offset;
+          buffer_offset += curr->get_register_size();
+          r.register_count = new_count;
+
+          sensorset_.insert(curr);
+          // move iterator backwards because it will be incremented later
+          ix--;
+
+          ESP_LOGV(TAG, "Join range over %u unused registers - change to register: 0x%X %d offset=%u", gap,
+                   curr->start_address, curr->register_count, curr->offset);
         }
       }
     }
@@ -341,9 +404,26 @@ size_t ModbusController::create_register_ranges_() {
   return register_ranges_.size();
 }
 
+void ModbusController::schedule_register_ranges_() {
+  // after the first read, ranges with the same skip_updates take turns instead of all being read in the same update
+  for (size_t i = 0; i < this->register_ranges_.size(); i++) {
+    auto &r = this->register_ranges_[i];
+    uint32_t index = 0;
+    for (size_t j = 0; j < i; j++) {
+      if (this->register_ranges_[j].skip_updates == r.skip_updates)
+        index++;
+    }
+    r.skip_updates_phase = index % (uint32_t(r.skip_updates) + 1);
+    r.phase_pending = true;
+  }
+}
+
 void ModbusController::dump_config() {
   ESP_LOGCONFIG(TAG, "ModbusController:");
   ESP_LOGCONFIG(TAG, "  Address: 0x%02X", this->address_);
+  ESP_LOGCONFIG(TAG, "  Max Register Gap: %u", this->max_register_gap_);
+  ESP_LOGCONFIG(TAG, "  Max Read Registers: %u", this->max_read_registers_);
+  ESP_LOGCONFIG(TAG, "  Register Ranges: %zu", this->register_ranges_.size());
 #if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_VERBOSE
   ESP_LOGCONFIG(TAG, "sensormap");
   for (auto &it : sensorset_) {
@@ -353,8 +433,9 @@ void ModbusController::dump_config() {
   }
   ESP_LOGCONFIG(TAG, "ranges");
   for (auto &it : register_ranges_) {
-    ESP_LOGCONFIG(TAG, "  Range type=%zu start=0x%X count=%d skip_updates=%d", static_cast<uint8_t>(it.register_type),
-                  it.start_address, it.register_count, it.skip_updates);
+    ESP_LOGCONFIG(TAG, "  Range type=%zu start=0x%X count=%d skip_updates=%d phase=%d",
+                  static_cast<uint8_t>(it.register_type), it.start_address, it.register_count, it.skip_updates,
+                  it.skip_updates_phase);
   }
   ESP_LOGCONFIG(TAG, "server registers");
   for (auto &r : server_registers_) {
@@ -365,16 +446,13 @@ void ModbusController::dump_config() {
 }
 
 void ModbusController::loop() {
-  // Incoming data to process?
+  // Incoming data to process? Pending commands are sent when the modbus bus asks for them.
   if (!incoming_queue_.empty()) {
     auto &message = incoming_queue_.front();
     if (message != nullptr)
       process_modbus_data_(message.get());
+    this->release_command_(std::move(message));
     incoming_queue_.pop();
-
-  } else {
-    // all messages processed send pending commands
-    send_next_command_();
   }
 }
 
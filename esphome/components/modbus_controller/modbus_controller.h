@@ -303,16 +303,21 @@ using SensorSet = std::set<SensorItem *, SensorItemsComparator>;
 struct RegisterRange {
   uint16_t start_address;
   ModbusRegisterType register_type;
-  uint8_t register_count;
+  uint16_t register_count;
   uint16_t skip_updates;          // the config value
   SensorSet sensors;              // all sensors of this range
   uint16_t skip_updates_counter;  // the running value
+  // updates to skip after the first read, spreads ranges with the same skip_updates over the update cycles
+  uint16_t skip_updates_phase;
+  bool phase_pending;  // the next read is the first one
 };
 
 class ModbusCommandItem {
  public:
   static const size_t MAX_PAYLOAD_BYTES = 240;
   static const uint8_t MAX_SEND_REPEATS = 5;
+  /// Most registers a single read can return (function code 3 and 4)
+  static const uint16_t MAX_READ_REGISTERS = 125;
   ModbusController *modbusdevice;
   uint16_t register_address;
   uint16_t register_count;
@@ -419,6 +424,8 @@ class ModbusCommandItem {
  *   Each instance handles the modbus commuinication for all sensors with the same modbus address
  *
  * all sensor items (sensors, switches, binarysensor ...) are parsed in modbus address ranges.
+ * Registers polled at the same rate are joined across up to max_register_gap unused registers, as long as the range
+ * doesn't exceed max_read_registers.
  * when esphome calls ModbusController::Update the commands for each range are created and sent
  * Responses for the commands are dispatched to the modbus sensor items.
  */
@@ -442,6 +449,8 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
   void on_modbus_error(uint8_t function_code, uint8_t exception_code) override;
   /// called when a modbus request (function code 3 or 4) was parsed without errors
   void on_modbus_read_registers(uint8_t function_code, uint16_t start_address, uint16_t number_of_registers) final;
+  /// called by the modbus bus when it is this device's turn to send
+  bool send_next_request() override { return this->send_next_command_(); }
   /// default delegate called by process_modbus_data when a response has retrieved from the incoming queue
   void on_register_data(ModbusRegisterType register_type, uint16_t start_address, const std::vector<uint8_t> &data);
   /// default delegate called by process_modbus_data when a response for a write response has retrieved from the
@@ -452,6 +461,10 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
   void set_command_throttle(uint16_t command_throttle) { this->command_throttle_ = command_throttle; }
   /// called by esphome generated code to set the offline_skip_updates
   void set_offline_skip_updates(uint16_t offline_skip_updates) { this->offline_skip_updates_ = offline_skip_updates; }
+  /// called by esphome generated code to set the number of unused registers a read may span to join two ranges
+  void set_max_register_gap(uint16_t max_register_gap) { this->max_register_gap_ = max_register_gap; }
+  /// called by esphome generated code to set the most registers read by a single command
+  void set_max_read_registers(uint16_t max_read_registers) { this->max_read_registers_ = max_read_registers; }
   /// get the number of queued modbus commands (should be mostly empty)
   size_t get_command_queue_length() { return command_queue_.size(); }
   /// get if the module is offline, didn't respond the last command
@@ -462,13 +475,19 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
  protected:
   /// parse sensormap_ and create range of sequential addresses
   size_t create_register_ranges_();
-  // find register in sensormap. Returns iterator with all registers having the same start address
-  SensorSet find_sensors_(ModbusRegisterType register_type, uint16_t start_address) const;
+  /// spread the first reads of ranges with the same skip_updates over the update cycles
+  void schedule_register_ranges_();
+  // find register in sensormap. Returns all registers having the same start address
+  const SensorSet &find_sensors_(ModbusRegisterType register_type, uint16_t start_address) const;
+  /// take a command from the pool of processed commands, their payloads keep their capacity
+  std::unique_ptr<ModbusCommandItem> allocate_command_();
+  /// return a command that has been sent or processed to the pool
+  void release_command_(std::unique_ptr<ModbusCommandItem> &&command);
   /// submit the read command for the address range to the send queue
   void update_range_(RegisterRange &r);
   /// parse incoming modbus data
   void process_modbus_data_(const ModbusCommandItem *response);
-  /// send the next modbus command from the send queue
+  /// send the next modbus command from the send queue, returns true if a command was sent
   bool send_next_command_();
   /// dump the parsed sensormap for diagnostics
   void dump_sensors_();
@@ -482,6 +501,8 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
   std::list<std::unique_ptr<ModbusCommandItem>> command_queue_;
   /// modbus response data waiting to get processed
   std::queue<std::unique_ptr<ModbusCommandItem>> incoming_queue_;
+  /// commands that were processed and can be reused
+  std::vector<std::unique_ptr<ModbusCommandItem>> command_pool_;
   /// when was the last send operation
   uint32_t last_command_timestamp_;
   /// min time in ms between sending modbus commands
@@ -490,6 +511,10 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
   bool module_offline_;
   /// how many updates to skip if module is offline
   uint16_t offline_skip_updates_;
+  /// unused registers a read may span to join the registers of two ranges
+  uint16_t max_register_gap_{0};
+  /// most registers read by a single command
+  uint16_t max_read_registers_{ModbusCommandItem::MAX_READ_REGISTERS};
   CallbackManager<void(int, int)> command_sent_callback_{};
 };
 
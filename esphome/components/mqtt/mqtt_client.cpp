@@ -2,6 +2,7 @@
 
 #ifdef USE_MQTT
 
+#include <algorithm>
 #include <utility>
 #include "esphome/components/network/util.h"
 #include "esphome/core/application.h"
@@ -169,6 +170,12 @@ void MQTTClientComponent::start_dnslookup_() {
     subscription.subscribed = false;
     subscription.resubscribe_timeout = 0;
   }
+  // states are sent again after connecting and QoS 0 messages may be lost anyway, the rest must be delivered
+  this->outbound_queue_.erase(std::remove_if(this->outbound_queue_.begin(), this->outbound_queue_.end(),
+                                             [](const MQTTQueuedMessage &pending) {
+                                               return pending.state || pending.message.qos == 0;
+                                             }),
+                              this->outbound_queue_.end());
 
   this->status_set_warning();
   this->dns_resolve_error_ = false;
@@ -360,9 +367,11 @@ void MQTTClientComponent::loop() {
 
         this->last_connected_ = now;
         this->resubscribe_subscriptions_();
+        this->process_outbound_queue_();
       }
       break;
   }
+  this->resends_this_loop_ = 0;
 
   if (millis() - this->last_connected_ > this->reboot_timeout_ && this->reboot_timeout_ != 0) {
     ESP_LOGE(TAG, "Can't connect to MQTT... Restarting...");
@@ -413,9 +422,10 @@ void MQTTClientComponent::subscribe(const std::string &topic, mqtt_callback_t ca
       .callback = std::move(callback),
       .subscribed = false,
       .resubscribe_timeout = 0,
+      .removed = false,
   };
   this->resubscribe_subscription_(&subscription);
-  this->subscriptions_.push_back(subscription);
+  this->add_subscription_(std::move(subscription));
 }
 
 void MQTTClientComponent::subscribe_json(const std::string &topic, const mqtt_json_callback_t &callback, uint8_t qos) {
@@ -431,9 +441,10 @@ void MQTTClientComponent::subscribe_json(const std::string &topic, const mqtt_js
       .callback = f,
       .subscribed = false,
       .resubscribe_timeout = 0,
+      .removed = false,
   };
   this->resubscribe_subscription_(&subscription);
-  this->subscriptions_.push_back(subscription);
+  this->add_subscription_(std::move(subscription));
 }
 
 void MQTTClientComponent::unsubscribe(const std::string &topic) {
@@ -447,14 +458,36 @@ void MQTTClientComponent::unsubscribe(const std::string &topic) {
     this->status_momentary_warning("unsubscribe", 1000);
   }
 
-  auto it = subscriptions_.begin();
-  while (it != subscriptions_.end()) {
-    if (it->topic == topic) {
-      it = subscriptions_.erase(it);
+  for (auto &subscription : this->subscriptions_) {
+    if (subscription.topic == topic)
+      subscription.removed = true;
+  }
+  // on_message() holds indices of the subscriptions while running the callbacks, erasing would shift them
+  if (this->dispatching_) {
+    this->erase_pending_ = true;
+  } else {
+    this->erase_removed_subscriptions_();
+  }
+}
+
+void MQTTClientComponent::erase_removed_subscriptions_() {
+  auto it = this->subscriptions_.begin();
+  while (it != this->subscriptions_.end()) {
+    if (it->removed) {
+      it = this->subscriptions_.erase(it);
     } else {
       ++it;
     }
   }
+  // the trie refers to subscriptions by their index, unsubscribing is rare enough to just rebuild it
+  this->subscription_trie_.clear();
+  for (size_t i = 0; i < this->subscriptions_.size(); i++)
+    this->subscription_trie_.insert(this->subscriptions_[i].topic, i);
+}
+
+void MQTTClientComponent::add_subscription_(MQTTSubscription &&subscription) {
+  this->subscription_trie_.insert(subscription.topic, this->subscriptions_.size());
+  this->subscriptions_.push_back(std::move(subscription));
 }
 
 // Publish
@@ -472,88 +505,101 @@ bool MQTTClientComponent::publish(const MQTTMessage &message) {
     // critical components will re-transmit their messages
     return false;
   }
-  bool logging_topic = this->log_message_.topic == message.topic;
-  bool ret = this->mqtt_backend_.publish(message);
-  delay(0);
-  if (!ret && !logging_topic && this->is_connected()) {
-    delay(0);
-    ret = this->mqtt_backend_.publish(message);
+  if (this->log_message_.topic == message.topic) {
+    // log messages are never queued, they would only fill the queue and arrive out of order with the log
+    bool ret = this->mqtt_backend_.publish(message);
     delay(0);
+    this->consume_publish_budget_(message.topic.size() + message.payload.size());
+    return ret;
   }
-
-  if (!logging_topic) {
-    if (ret) {
-      ESP_LOGV(TAG, "Publish(topic='%s' payload='%s' retain=%d qos=%d)", message.topic.c_str(), message.payload.c_str(),
-               message.retain, message.qos);
-    } else {
-      ESP_LOGV(TAG, "Publish failed for topic='%s' (len=%u). will retry later..", message.topic.c_str(),
-               message.payload.length());
-      this->status_momentary_warning("publish", 1000);
-    }
-  }
-  return ret != 0;
-}
-bool MQTTClientComponent::publish_json(const std::string &topic, const json::json_build_t &f, uint8_t qos,
-                                       bool retain) {
-  std::string message = json::build_json(f);
-  return this->publish(topic, message, qos, retain);
-}
-
-/** Check if the message topic matches the given subscription topic
- *
- * INFO: MQTT spec mandates that topics must not be empty and must be valid NULL-terminated UTF-8 strings.
- *
- * @param message The message topic that was received from the MQTT server. Note: this must not contain
- *                wildcard characters as mandated by the MQTT spec.
- * @param subscription The subscription topic we are matching against.
- * @param is_normal Is this a "normal" topic - Does the message topic not begin with a "$".
- * @param past_separator Are we past the first '/' topic separator.
- * @return true if the subscription topic matches the message topic, false otherwise.
- */
-static bool topic_match(const char *message, const char *subscription, bool is_normal, bool past_separator) {
-  // Reached end of both strings at the same time, this means we have a successful match
-  if (*message == '\0' && *subscription == '\0')
+  // keep the order of the messages, anything new waits behind the queued ones
+  if (this->outbound_queue_.empty() && this->has_publish_budget_() && this->send_(message))
     return true;
+  return this->enqueue_(message, false);
+}
 
-  // Either the message or the subscribe are at the end. This means they don't match.
-  if (*message == '\0' || *subscription == '\0')
+bool MQTTClientComponent::publish_state(const std::string &topic, const std::string &payload, uint8_t qos,
+                                        bool retain) {
+  if (!this->is_connected())
     return false;
+  MQTTMessage message{.topic = topic, .payload = payload, .qos = qos, .retain = retain};
+  if (this->outbound_queue_.empty() && this->has_publish_budget_() && this->send_(message))
+    return true;
+  return this->enqueue_(message, true);
+}
 
-  bool do_wildcards = is_normal || past_separator;
-
-  if (*subscription == '+' && do_wildcards) {
-    // single level wildcard
-    // consume + from subscription
-    subscription++;
-    // consume everything from message until '/' found or end of string
-    while (*message != '\0' && *message != '/') {
-      message++;
+bool MQTTClientComponent::send_(const MQTTMessage &message) {
+  bool ret = this->mqtt_backend_.publish(message);
+  delay(0);
+  if (ret) {
+    this->consume_publish_budget_(message.topic.size() + message.payload.size());
+    ESP_LOGV(TAG, "Publish(topic='%s' payload='%s' retain=%d qos=%d)", message.topic.c_str(), message.payload.c_str(),
+             message.retain, message.qos);
+  } else {
+    ESP_LOGV(TAG, "Publish failed for topic='%s' (len=%u). will retry later..", message.topic.c_str(),
+             message.payload.length());
+  }
+  return ret;
+}
+
+bool MQTTClientComponent::enqueue_(const MQTTMessage &message, bool state) {
+  if (state) {
+    // only the latest state matters, it takes the place of the queued one
+    for (auto &pending : this->outbound_queue_) {
+      if (pending.state && pending.message.topic == message.topic) {
+        pending.message.payload = message.payload;
+        pending.message.qos = message.qos;
+        pending.message.retain = message.retain;
+        return true;
+      }
     }
-    // after this, both pointers will point to a '/' or to the end of the string
-
-    return topic_match(message, subscription, is_normal, true);
   }
-
-  if (*subscription == '#' && do_wildcards) {
-    // multilevel wildcard - MQTT mandates that this must be at end of subscribe topic
-    return true;
+  if (this->outbound_queue_.size() >= MQTT_OUTBOUND_QUEUE_SIZE) {
+    // make room by dropping the oldest QoS 0 message, messages with a higher QoS must be delivered
+    auto it = std::find_if(this->outbound_queue_.begin(), this->outbound_queue_.end(),
+                           [](const MQTTQueuedMessage &pending) { return pending.message.qos == 0; });
+    if (it == this->outbound_queue_.end()) {
+      ESP_LOGW(TAG, "Outbound queue full, publish to '%s' failed", message.topic.c_str());
+      this->status_momentary_warning("publish", 1000);
+      return false;
+    }
+    ESP_LOGW(TAG, "Outbound queue full, dropped message to '%s'", it->message.topic.c_str());
+    this->status_momentary_warning("publish", 1000);
+    this->outbound_queue_.erase(it);
+  }
+  this->outbound_queue_.push_back(MQTTQueuedMessage{.message = message, .state = state});
+  return true;
+}
+
+void MQTTClientComponent::process_outbound_queue_() {
+  if (this->publish_rate_limit_ != 0) {
+    const uint32_t now = millis();
+    const uint32_t refill = uint64_t(now - this->last_budget_refill_) * this->publish_rate_limit_ / 1000;
+    // keep the remainder for the next iteration if the loop runs faster than one byte per millisecond
+    if (refill > 0) {
+      this->publish_budget_ = std::min<int64_t>(int64_t(this->publish_budget_) + refill, this->publish_rate_limit_);
+      this->last_budget_refill_ = now;
+    }
   }
+  // the budget can go negative for a large message, it's paid back before the next one is sent
+  while (!this->outbound_queue_.empty() && this->has_publish_budget_()) {
+    if (!this->send_(this->outbound_queue_.front().message))
+      break;
+    this->outbound_queue_.pop_front();
+  }
+}
 
-  // this handles '/' and normal characters at the same time.
-  if (*message != *subscription)
+bool MQTTClientComponent::can_resend_state() {
+  if (this->resends_this_loop_ >= MQTT_RESENDS_PER_LOOP ||
+      this->outbound_queue_.size() > MQTT_OUTBOUND_QUEUE_SIZE / 2 || !this->has_publish_budget_())
     return false;
-
-  past_separator = past_separator || *subscription == '/';
-
-  // consume characters
-  subscription++;
-  message++;
-
-  return topic_match(message, subscription, is_normal, past_separator);
+  this->resends_this_loop_++;
+  return true;
 }
-
-static bool topic_match(const char *message, const char *subscription) {
-  return topic_match(message, subscription, *message != '\0' && *message != '$', false);
+bool MQTTClientComponent::publish_json(const std::string &topic, const json::json_build_t &f, uint8_t qos,
+                                       bool retain) {
+  std::string message = json::build_json(f);
+  return this->publish(topic, message, qos, retain);
 }
 
 void MQTTClientComponent::on_message(const std::string &topic, const std::string &payload) {
@@ -562,9 +608,19 @@ void MQTTClientComponent::on_message(const std::string &topic, const std::string
   // from a different task.
   this->defer([this, topic, payload]() {
 #endif
-    for (auto &subscription : this->subscriptions_) {
-      if (topic_match(topic.c_str(), subscription.topic.c_str()))
-        subscription.callback(topic, payload);
+    this->matched_subscriptions_.clear();
+    this->subscription_trie_.match(topic, this->matched_subscriptions_);
+    this->dispatching_ = true;
+    for (size_t i = 0; i < this->matched_subscriptions_.size(); i++) {
+      const uint16_t index = this->matched_subscriptions_[i];
+      // a previous callback may have unsubscribed
+      if (!this->subscriptions_[index].removed)
+        this->subscriptions_[index].callback(topic, payload);
+    }
+    this->dispatching_ = false;
+    if (this->erase_pending_) {
+      this->erase_pending_ = false;
+      this->erase_removed_subscriptions_();
     }
 #ifdef USE_ESP8266
   });
@@ -578,6 +634,10 @@ void MQTTClientComponent::set_reboot_timeout(uint32_t reboot_timeout) { this->re
 void MQTTClientComponent::register_mqtt_component(MQTTComponent *component) { this->children_.push_back(component); }
 void MQTTClientComponent::set_log_level(int level) { this->log_level_ = level; }
 void MQTTClientComponent::set_keep_alive(uint16_t keep_alive_s) { this->mqtt_backend_.set_keep_alive(keep_alive_s); }
+void MQTTClientComponent::set_publish_rate_limit(uint32_t bytes_per_second) {
+  this->publish_rate_limit_ = bytes_per_second;
+  this->publish_budget_ = bytes_per_second;
+}
 void MQTTClientComponent::set_log_message_template(MQTTMessage &&message) { this->log_message_ = std::move(message); }
 const MQTTDiscoveryInfo &MQTTClientComponent::get_discovery_info() const { return this->discovery_info_; }
 void MQTTClientComponent::set_topic_prefix(const std::string &topic_prefix) { this->topic_prefix_ = topic_prefix; }
@@ -17,7 +17,9 @@
 #include "mqtt_backend_libretiny.h"
 #endif
 #include "lwip/ip_addr.h"
+#include "mqtt_topic_trie.h"
 
+#include <deque>
 #include <vector>
 
 namespace esphome {
@@ -35,6 +37,18 @@ using mqtt_on_disconnect_callback_t = std::function<MQTTBackend::on_disconnect_c
 using mqtt_callback_t = std::function<void(const std::string &, const std::string &)>;
 using mqtt_json_callback_t = std::function<void(const std::string &, JsonObject)>;
 
+/// Maximum number of messages waiting in the outbound queue.
+static const size_t MQTT_OUTBOUND_QUEUE_SIZE = 32;
+/// Maximum number of components that send their discovery and state in one loop iteration after (re)connecting.
+static const uint8_t MQTT_RESENDS_PER_LOOP = 2;
+
+/// internal struct for messages waiting in the outbound queue.
+struct MQTTQueuedMessage {
+  MQTTMessage message;
+  /// Published with publish_state(): replaced by a newer state and sent again by its component after reconnecting.
+  bool state;
+};
+
 /// internal struct for MQTT subscriptions.
 struct MQTTSubscription {
   std::string topic;
@@ -42,6 +56,8 @@ struct MQTTSubscription {
   mqtt_callback_t callback;
   bool subscribed;
   uint32_t resubscribe_timeout;
+  /// Unsubscribed while on_message() was running, erased once it's done.
+  bool removed;
 };
 
 /// internal struct for MQTT credentials.
@@ -113,6 +129,8 @@ class MQTTClientComponent : public Component {
 
   /// Set the keep alive time in seconds, every 0.7*keep_alive a ping will be sent.
   void set_keep_alive(uint16_t keep_alive_s);
+  /// Limit publishing to this many bytes (topic and payload) per second on average, 0 for no limit.
+  void set_publish_rate_limit(uint32_t bytes_per_second);
 
   /** Set the Home Assistant discovery info
    *
@@ -203,11 +221,27 @@ class MQTTClientComponent : public Component {
   void unsubscribe(const std::string &topic);
 
   /** Publish a MQTTMessage
+   *
+   * If the message can't be sent right away (rate limit or full backend buffers), it's queued and sent from loop().
    *
    * @param message The message.
+   * @return false if not connected or the outbound queue is full.
    */
   bool publish(const MQTTMessage &message);
 
+  /** Publish the state of an entity.
+   *
+   * Same as publish(), but if a message to the same topic is still queued, it's replaced instead of sending both.
+   */
+  bool publish_state(const std::string &topic, const std::string &payload, uint8_t qos = 0, bool retain = false);
+
+  /** Called by MQTTComponent before it sends its discovery and state after (re)connecting.
+   *
+   * Returns false when enough components did so in this loop iteration or the outbound queue is filling up, the
+   * component should try again in the next iteration.
+   */
+  bool can_resend_state();
+
   /** Publish a MQTT message
    *
    * @param topic The topic.
@@ -273,9 +307,20 @@ class MQTTClientComponent : public Component {
   /// Re-calculate the availability property.
   void recalculate_availability_();
 
+  bool send_(const MQTTMessage &message);
+  bool enqueue_(const MQTTMessage &message, bool state);
+  void process_outbound_queue_();
+  bool has_publish_budget_() const { return this->publish_rate_limit_ == 0 || this->publish_budget_ > 0; }
+  void consume_publish_budget_(size_t bytes) {
+    if (this->publish_rate_limit_ != 0)
+      this->publish_budget_ -= bytes;
+  }
+
   bool subscribe_(const char *topic, uint8_t qos);
   void resubscribe_subscription_(MQTTSubscription *sub);
   void resubscribe_subscriptions_();
+  void add_subscription_(MQTTSubscription &&subscription);
+  void erase_removed_subscriptions_();
 
   MQTTCredentials credentials_;
   /// The last will message. Disabled optional denotes it being default and
@@ -304,6 +349,21 @@ class MQTTClientComponent : public Component {
   int log_level_{ESPHOME_LOG_LEVEL};
 
   std::vector<MQTTSubscription> subscriptions_;
+  /// Topic filters of subscriptions_, by index.
+  MQTTTopicTrie subscription_trie_;
+  /// Reused by on_message() to collect the matching subscriptions.
+  std::vector<uint16_t> matched_subscriptions_;
+  /// Set while on_message() runs the callbacks, unsubscribe() must not move subscriptions then.
+  bool dispatching_{false};
+  /// A callback unsubscribed, on_message() erases the removed subscriptions when it's done.
+  bool erase_pending_{false};
+
+  std::deque<MQTTQueuedMessage> outbound_queue_;
+  uint32_t publish_rate_limit_{0};
+  /// Bytes that can be published right now, refilled at publish_rate_limit_ up to one second worth.
+  int32_t publish_budget_{0};
+  uint32_t last_budget_refill_{0};
+  uint8_t resends_this_loop_{0};
 #if defined(USE_ESP32)
   MQTTBackendESP32 mqtt_backend_;
 #elif defined(USE_ESP8266)
@@ -49,13 +49,13 @@ std::string MQTTComponent::get_command_topic_() const {
 bool MQTTComponent::publish(const std::string &topic, const std::string &payload) {
   if (topic.empty())
     return false;
-  return global_mqtt_client->publish(topic, payload, this->qos_, this->retain_);
+  return global_mqtt_client->publish_state(topic, payload, this->qos_, this->retain_);
 }
 
 bool MQTTComponent::publish_json(const std::string &topic, const json::json_build_t &f) {
   if (topic.empty())
     return false;
-  return global_mqtt_client->publish_json(topic, f, this->qos_, this->retain_);
+  return global_mqtt_client->publish_state(topic, json::build_json(f), this->qos_, this->retain_);
 }
 
 bool MQTTComponent::send_discovery_() {
@@ -241,6 +241,12 @@ void MQTTComponent::call_setup() {
   if (!this->is_connected_())
     return;
 
+  // send discovery and state from the loop, a few components at a time
+  if (!global_mqtt_client->can_resend_state()) {
+    this->schedule_resend_state();
+    return;
+  }
+
   if (this->is_discovery_enabled()) {
     if (!this->send_discovery_()) {
       this->schedule_resend_state();
@@ -257,7 +263,7 @@ void MQTTComponent::call_loop() {
 
   this->loop();
 
-  if (!this->resend_state_ || !this->is_connected_()) {
+  if (!this->resend_state_ || !this->is_connected_() || !global_mqtt_client->can_resend_state()) {
     return;
   }
 
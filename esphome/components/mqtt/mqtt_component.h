@@ -112,7 +112,7 @@ class MQTTComponent : public Component {
   /// Internal method for the MQTT client base to schedule a resend of the state on reconnect.
   void schedule_resend_state();
 
-  /** Send a MQTT message.
+  /** Send a MQTT state message, replacing a message to the same topic that is still queued.
    *
    * @param topic The topic.
    * @param payload The payload.
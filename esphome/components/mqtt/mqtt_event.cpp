@@ -40,8 +40,10 @@ void MQTTEventComponent::dump_config() {
 }
 
 bool MQTTEventComponent::publish_event_(const std::string &event_type) {
-  return this->publish_json(this->get_state_topic_(),
-                            [event_type](JsonObject root) { root[MQTT_EVENT_TYPE] = event_type; });
+  // events must not replace each other in the outbound queue like states do
+  return global_mqtt_client->publish_json(
+      this->get_state_topic_(), [event_type](JsonObject root) { root[MQTT_EVENT_TYPE] = event_type; }, this->qos_,
+      this->retain_);
 }
 
 std::string MQTTEventComponent::component_type() const { return "event"; }
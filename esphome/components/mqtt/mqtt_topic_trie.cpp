@@ -0,0 +1,88 @@
+#include "mqtt_topic_trie.h"
+
+#ifdef USE_MQTT
+
+#include <algorithm>
+#include <cstring>
+
+namespace esphome {
+namespace mqtt {
+
+static bool level_less(const std::string &a, const char *b, size_t length) {
+  return a.compare(0, std::string::npos, b, length) < 0;
+}
+
+void MQTTTopicTrie::insert(const std::string &filter, uint16_t id) {
+  Node *node = &this->root_;
+  const char *level = filter.c_str();
+  const char *end = level + filter.size();
+  while (true) {
+    const char *separator = static_cast<const char *>(memchr(level, '/', end - level));
+    const size_t length = (separator != nullptr ? separator : end) - level;
+    auto it = std::lower_bound(
+        node->children.begin(), node->children.end(), level,
+        [length](const Node &child, const char *l) { return level_less(child.level, l, length); });
+    if (it == node->children.end() || it->level.compare(0, std::string::npos, level, length) != 0) {
+      it = node->children.insert(it, Node{});
+      it->level.assign(level, length);
+    }
+    node = &*it;
+    if (separator == nullptr)
+      break;
+    level = separator + 1;
+  }
+  node->ids.push_back(id);
+}
+
+void MQTTTopicTrie::clear() { this->root_ = Node{}; }
+
+const MQTTTopicTrie::Node *MQTTTopicTrie::find_child_(const Node &node, const char *level, size_t length) {
+  auto it = std::lower_bound(node.children.begin(), node.children.end(), level,
+                             [length](const Node &child, const char *l) { return level_less(child.level, l, length); });
+  if (it == node.children.end() || it->level.compare(0, std::string::npos, level, length) != 0)
+    return nullptr;
+  return &*it;
+}
+
+void MQTTTopicTrie::match(const std::string &topic, std::vector<uint16_t> &ids) const {
+  const size_t start = ids.size();
+  match_(this->root_, topic.c_str(), topic.c_str() + topic.size(), true, ids);
+  // more than one match is rare (a wildcard and a literal filter for the same topic)
+  if (ids.size() - start > 1)
+    std::sort(ids.begin() + start, ids.end());
+}
+
+void MQTTTopicTrie::match_(const Node &node, const char *level, const char *end, bool first,
+                           std::vector<uint16_t> &ids) {
+  // level is nullptr once all levels of the topic have been consumed
+  if (level == nullptr) {
+    ids.insert(ids.end(), node.ids.begin(), node.ids.end());
+    return;
+  }
+  const char *separator = static_cast<const char *>(memchr(level, '/', end - level));
+  const size_t length = (separator != nullptr ? separator : end) - level;
+  const char *next = separator != nullptr ? separator + 1 : nullptr;
+
+  const Node *child = find_child_(node, level, length);
+  if (child != nullptr)
+    match_(*child, next, end, false, ids);
+
+  // wildcards don't match an empty last level or the first level of topics like $SYS
+  if (level == end || (first && *level == '$'))
+    return;
+  if (!(length == 1 && *level == '+')) {
+    child = find_child_(node, "+", 1);
+    if (child != nullptr)
+      match_(*child, next, end, false, ids);
+  }
+  if (!(length == 1 && *level == '#')) {
+    child = find_child_(node, "#", 1);
+    if (child != nullptr)
+      ids.insert(ids.end(), child->ids.begin(), child->ids.end());
+  }
+}
+
+}  // namespace mqtt
+}  // namespace esphome
+
+#endif  // USE_MQTT
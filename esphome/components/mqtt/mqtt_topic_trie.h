@@ -0,0 +1,55 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_MQTT
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace esphome {
+namespace mqtt {
+
+/** Index of subscription topic filters, organized by topic level.
+ *
+ * Every node is one level of a topic filter, with the literal levels of its children sorted so they can be binary
+ * searched. The '+' and '#' wildcards are stored as children with that level. Matching a topic follows the literal
+ * and the wildcard children, so it takes time proportional to the depth of the topic instead of the number of
+ * subscriptions.
+ *
+ * The matching rules are the same as the previous per-subscription matcher: '+' matches one level and '#' the rest
+ * of the topic, neither matches if the rest of the topic is empty, and wildcards in the first level don't match
+ * topics starting with '$'.
+ */
+class MQTTTopicTrie {
+ public:
+  /// Add \p id (the index of the subscription) for the topic filter \p filter.
+  void insert(const std::string &filter, uint16_t id);
+  void clear();
+
+  /** Append the ids of all filters matching \p topic to \p ids.
+   *
+   * The ids are sorted, so callbacks run in the order the subscriptions were made.
+   */
+  void match(const std::string &topic, std::vector<uint16_t> &ids) const;
+
+ protected:
+  struct Node {
+    std::string level;
+    /// Sorted by level.
+    std::vector<Node> children;
+    std::vector<uint16_t> ids;
+  };
+
+  static const Node *find_child_(const Node &node, const char *level, size_t length);
+  static void match_(const Node &node, const char *level, const char *end, bool first, std::vector<uint16_t> &ids);
+
+  Node root_;
+};
+
+}  // namespace mqtt
+}  // namespace esphome
+
+#endif  // USE_MQTT
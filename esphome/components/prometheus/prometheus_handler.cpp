@@ -2,353 +2,478 @@
 #ifdef USE_NETWORK
 #include "esphome/core/application.h"
 
+#include <algorithm>
+#include <cinttypes>
+#include <cmath>
+#include <cstring>
+#include <memory>
+
+#ifdef USE_ESP32
+#include <esp_heap_caps.h>
+#endif
+#ifdef USE_ESP8266
+#include <Esp.h>
+#endif
+
 namespace esphome {
 namespace prometheus {
 
-void PrometheusHandler::handleRequest(AsyncWebServerRequest *req) {
-  AsyncResponseStream *stream = req->beginResponseStream("text/plain; version=0.0.4; charset=utf-8");
+// The metric names are kept in flash on ESP8266, like the F() strings of the stream based writer before.
+#ifdef USE_ESP8266
+#define PROM_STR(s) PSTR(s)
+static void append(std::string &out, const char *str) {
+  const size_t length = strlen_P(str);
+  const size_t position = out.size();
+  out.resize(position + length);
+  memcpy_P(&out[position], str, length);
+}
+#else
+#define PROM_STR(s) (s)
+static void append(std::string &out, const char *str) { out.append(str); }
+#endif
+
+/// Append a label value, escaped as required by the text exposition format.
+static void append_label_value(std::string &out, const std::string &value) {
+  for (char c : value) {
+    if (c == '\\' || c == '"') {
+      out += '\\';
+      out += c;
+    } else if (c == '\n') {
+      out += "\\n";
+    } else {
+      out += c;
+    }
+  }
+}
+
+/// Same format as Print::print(float) (two decimals) that the stream based writer used.
+static void append_float(std::string &out, float value) {
+  char buffer[32];
+  snprintf(buffer, sizeof(buffer), "%.2f", value);
+  out += buffer;
+}
 
+static void append_uint(std::string &out, uint32_t value) {
+  char buffer[12];
+  snprintf(buffer, sizeof(buffer), "%" PRIu32, value);
+  out += buffer;
+}
+
+/// Same as value_accuracy_to_string() without the temporary string.
+static void append_value_accuracy(std::string &out, float value, int8_t accuracy_decimals) {
+  if (accuracy_decimals < 0) {
+    auto multiplier = powf(10.0f, accuracy_decimals);
+    value = roundf(value * multiplier) / multiplier;
+    accuracy_decimals = 0;
+  }
+  char buffer[32];
+  snprintf(buffer, sizeof(buffer), "%.*f", accuracy_decimals, value);
+  out += buffer;
+}
+
+void PrometheusHandler::setup() {
+  // The entities and their relabeling are all known now, so the labels can be formatted once instead of on every
+  // scrape.
 #ifdef USE_SENSOR
-  this->sensor_type_(stream);
-  for (auto *obj : App.get_sensors())
-    this->sensor_row_(stream, obj);
+  for (auto *obj : App.get_sensors()) {
+    const std::string unit = obj->get_unit_of_measurement();
+    this->add_metric_(SECTION_SENSOR, obj, &unit);
+  }
 #endif
-
 #ifdef USE_BINARY_SENSOR
-  this->binary_sensor_type_(stream);
   for (auto *obj : App.get_binary_sensors())
-    this->binary_sensor_row_(stream, obj);
+    this->add_metric_(SECTION_BINARY_SENSOR, obj);
 #endif
-
 #ifdef USE_FAN
-  this->fan_type_(stream);
   for (auto *obj : App.get_fans())
-    this->fan_row_(stream, obj);
+    this->add_metric_(SECTION_FAN, obj);
 #endif
-
 #ifdef USE_LIGHT
-  this->light_type_(stream);
   for (auto *obj : App.get_lights())
-    this->light_row_(stream, obj);
+    this->add_metric_(SECTION_LIGHT, obj);
 #endif
-
 #ifdef USE_COVER
-  this->cover_type_(stream);
   for (auto *obj : App.get_covers())
-    this->cover_row_(stream, obj);
+    this->add_metric_(SECTION_COVER, obj);
 #endif
-
 #ifdef USE_SWITCH
-  this->switch_type_(stream);
   for (auto *obj : App.get_switches())
-    this->switch_row_(stream, obj);
+    this->add_metric_(SECTION_SWITCH, obj);
 #endif
-
 #ifdef USE_LOCK
-  this->lock_type_(stream);
   for (auto *obj : App.get_locks())
-    this->lock_row_(stream, obj);
+    this->add_metric_(SECTION_LOCK, obj);
 #endif
+  // metrics were added in section order
+  size_t index = 0;
+  for (uint8_t section = 0; section <= SECTION_COUNT; section++) {
+    while (index < this->metrics_.size() && this->metrics_[index].section < section)
+      index++;
+    this->section_start_[section] = index;
+  }
+  this->labels_.shrink_to_fit();
+  this->metrics_.shrink_to_fit();
+  this->relabel_map_id_.clear();
+  this->relabel_map_name_.clear();
 
+  this->base_->init();
+  this->base_->add_handler(this);
+}
+
+void PrometheusHandler::add_metric_(Section section, EntityBase *obj, const std::string *unit) {
+  if (obj->is_internal() && !this->include_internal_)
+    return;
+
+  Metric metric{};
+  metric.obj = obj;
+  metric.section = section;
+  metric.labels_offset = this->labels_.size();
+  auto id = this->relabel_map_id_.find(obj);
+  auto name = this->relabel_map_name_.find(obj);
+  append(this->labels_, PROM_STR("id=\""));
+  append_label_value(this->labels_, id == this->relabel_map_id_.end() ? obj->get_object_id() : id->second);
+  append(this->labels_, PROM_STR("\",name=\""));
+  append_label_value(this->labels_, name == this->relabel_map_name_.end() ? obj->get_name() : name->second);
+  this->labels_ += '"';
+  metric.labels_length = this->labels_.size() - metric.labels_offset;
+  if (unit != nullptr) {
+    append(this->labels_, PROM_STR(",unit=\""));
+    append_label_value(this->labels_, *unit);
+    this->labels_ += '"';
+    metric.unit_length = this->labels_.size() - metric.labels_offset - metric.labels_length;
+  }
+  this->metrics_.push_back(metric);
+}
+
+void PrometheusHandler::handleRequest(AsyncWebServerRequest *req) {
+  auto scrape = std::make_shared<Scrape>();
+#ifdef USE_ARDUINO
+  // The response is generated while it's sent, a chunk (about one TCP segment) at a time, so it's never held in
+  // memory as a whole.
+  AsyncWebServerResponse *response =
+      req->beginChunkedResponse("text/plain; version=0.0.4; charset=utf-8",
+                                [this, scrape](uint8_t *buffer, size_t max_length, size_t /*index*/) -> size_t {
+                                  return this->fill_(*scrape, buffer, max_length);
+                                });
+  req->send(response);
+#else
+  AsyncResponseStream *stream = req->beginResponseStream("text/plain; version=0.0.4; charset=utf-8");
+  while (this->write_next_(*scrape, scrape->pending)) {
+    stream->print(scrape->pending);
+    scrape->pending.clear();
+  }
   req->send(stream);
+#endif
 }
 
-std::string PrometheusHandler::relabel_id_(EntityBase *obj) {
-  auto item = relabel_map_id_.find(obj);
-  return item == relabel_map_id_.end() ? obj->get_object_id() : item->second;
+size_t PrometheusHandler::fill_(Scrape &scrape, uint8_t *buffer, size_t max_length) {
+  size_t length = 0;
+  while (length < max_length) {
+    if (scrape.pending_position == scrape.pending.size()) {
+      scrape.pending.clear();
+      scrape.pending_position = 0;
+      if (!this->write_next_(scrape, scrape.pending))
+        break;
+    }
+    const size_t count = std::min(scrape.pending.size() - scrape.pending_position, max_length - length);
+    memcpy(buffer + length, scrape.pending.data() + scrape.pending_position, count);
+    scrape.pending_position += count;
+    length += count;
+  }
+  return length;
 }
 
-std::string PrometheusHandler::relabel_name_(EntityBase *obj) {
-  auto item = relabel_map_name_.find(obj);
-  return item == relabel_map_name_.end() ? obj->get_name() : item->second;
+bool PrometheusHandler::write_next_(Scrape &scrape, std::string &out) {
+  while (scrape.section < SECTION_COUNT) {
+    const auto section = static_cast<Section>(scrape.section);
+    const uint16_t first = this->section_start_[section];
+    const uint16_t count = this->section_start_[section + 1] - first;
+    if (scrape.index == 0) {
+      scrape.index++;
+      this->write_type_(section, out);
+      if (!out.empty())
+        return true;
+    }
+    if (scrape.index <= count) {
+      this->write_row_(section, this->metrics_[first + scrape.index - 1], out);
+      scrape.index++;
+      return true;
+    }
+    scrape.section++;
+    scrape.index = 0;
+  }
+  return false;
 }
 
-// Type-specific implementation
+void PrometheusHandler::begin_row_(const char *name, const Metric &metric, std::string &out, bool with_unit) {
+  append(out, name);
+  out += '{';
+  out.append(this->labels_, metric.labels_offset, metric.labels_length + (with_unit ? metric.unit_length : 0));
+}
+
+void PrometheusHandler::write_type_(Section section, std::string &out) {
+  switch (section) {
+#ifdef USE_SENSOR
+    case SECTION_SENSOR:
+      append(out, PROM_STR("#TYPE esphome_sensor_value gauge\n"
+                           "#TYPE esphome_sensor_failed gauge\n"));
+      break;
+#endif
+#ifdef USE_BINARY_SENSOR
+    case SECTION_BINARY_SENSOR:
+      append(out, PROM_STR("#TYPE esphome_binary_sensor_value gauge\n"
+                           "#TYPE esphome_binary_sensor_failed gauge\n"));
+      break;
+#endif
+#ifdef USE_FAN
+    case SECTION_FAN:
+      append(out, PROM_STR("#TYPE esphome_fan_value gauge\n"
+                           "#TYPE esphome_fan_failed gauge\n"
+                           "#TYPE esphome_fan_speed gauge\n"
+                           "#TYPE esphome_fan_oscillation gauge\n"));
+      break;
+#endif
+#ifdef USE_LIGHT
+    case SECTION_LIGHT:
+      append(out, PROM_STR("#TYPE esphome_light_state gauge\n"
+                           "#TYPE esphome_light_color gauge\n"
+                           "#TYPE esphome_light_effect_active gauge\n"));
+      break;
+#endif
+#ifdef USE_COVER
+    case SECTION_COVER:
+      append(out, PROM_STR("#TYPE esphome_cover_value gauge\n"
+                           "#TYPE esphome_cover_failed gauge\n"));
+      break;
+#endif
+#ifdef USE_SWITCH
+    case SECTION_SWITCH:
+      append(out, PROM_STR("#TYPE esphome_switch_value gauge\n"
+                           "#TYPE esphome_switch_failed gauge\n"));
+      break;
+#endif
+#ifdef USE_LOCK
+    case SECTION_LOCK:
+      append(out, PROM_STR("#TYPE esphome_lock_value gauge\n"
+                           "#TYPE esphome_lock_failed gauge\n"));
+      break;
+#endif
+    case SECTION_DEVICE:
+      this->device_rows_(out);
+      break;
+    default:
+      break;
+  }
+}
+
+void PrometheusHandler::write_row_(Section section, const Metric &metric, std::string &out) {
+  switch (section) {
 #ifdef USE_SENSOR
-void PrometheusHandler::sensor_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_sensor_value gauge\n"));
-  stream->print(F("#TYPE esphome_sensor_failed gauge\n"));
+    case SECTION_SENSOR:
+      this->sensor_row_(static_cast<sensor::Sensor *>(metric.obj), metric, out);
+      break;
+#endif
+#ifdef USE_BINARY_SENSOR
+    case SECTION_BINARY_SENSOR:
+      this->binary_sensor_row_(static_cast<binary_sensor::BinarySensor *>(metric.obj), metric, out);
+      break;
+#endif
+#ifdef USE_FAN
+    case SECTION_FAN:
+      this->fan_row_(static_cast<fan::Fan *>(metric.obj), metric, out);
+      break;
+#endif
+#ifdef USE_LIGHT
+    case SECTION_LIGHT:
+      this->light_row_(static_cast<light::LightState *>(metric.obj), metric, out);
+      break;
+#endif
+#ifdef USE_COVER
+    case SECTION_COVER:
+      this->cover_row_(static_cast<cover::Cover *>(metric.obj), metric, out);
+      break;
+#endif
+#ifdef USE_SWITCH
+    case SECTION_SWITCH:
+      this->switch_row_(static_cast<switch_::Switch *>(metric.obj), metric, out);
+      break;
+#endif
+#ifdef USE_LOCK
+    case SECTION_LOCK:
+      this->lock_row_(static_cast<lock::Lock *>(metric.obj), metric, out);
+      break;
+#endif
+    default:
+      break;
+  }
 }
-void PrometheusHandler::sensor_row_(AsyncResponseStream *stream, sensor::Sensor *obj) {
-  if (obj->is_internal() && !this->include_internal_)
-    return;
+
+// Type-specific implementation
+#ifdef USE_SENSOR
+void PrometheusHandler::sensor_row_(sensor::Sensor *obj, const Metric &metric, std::string &out) {
+  this->begin_row_(PROM_STR("esphome_sensor_failed"), metric, out);
   if (!std::isnan(obj->state)) {
     // We have a valid value, output this value
-    stream->print(F("esphome_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} 0\n"));
+    append(out, PROM_STR("} 0\n"));
     // Data itself
-    stream->print(F("esphome_sensor_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\",unit=\""));
-    stream->print(obj->get_unit_of_measurement().c_str());
-    stream->print(F("\"} "));
-    stream->print(value_accuracy_to_string(obj->state, obj->get_accuracy_decimals()).c_str());
-    stream->print(F("\n"));
+    this->begin_row_(PROM_STR("esphome_sensor_value"), metric, out, true);
+    append(out, PROM_STR("} "));
+    append_value_accuracy(out, obj->state, obj->get_accuracy_decimals());
+    out += '\n';
   } else {
     // Invalid state
-    stream->print(F("esphome_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} 1\n"));
+    append(out, PROM_STR("} 1\n"));
   }
 }
 #endif
 
-// Type-specific implementation
 #ifdef USE_BINARY_SENSOR
-void PrometheusHandler::binary_sensor_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_binary_sensor_value gauge\n"));
-  stream->print(F("#TYPE esphome_binary_sensor_failed gauge\n"));
-}
-void PrometheusHandler::binary_sensor_row_(AsyncResponseStream *stream, binary_sensor::BinarySensor *obj) {
-  if (obj->is_internal() && !this->include_internal_)
-    return;
+void PrometheusHandler::binary_sensor_row_(binary_sensor::BinarySensor *obj, const Metric &metric, std::string &out) {
+  this->begin_row_(PROM_STR("esphome_binary_sensor_failed"), metric, out);
   if (obj->has_state()) {
     // We have a valid value, output this value
-    stream->print(F("esphome_binary_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} 0\n"));
+    append(out, PROM_STR("} 0\n"));
     // Data itself
-    stream->print(F("esphome_binary_sensor_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} "));
-    stream->print(obj->state);
-    stream->print(F("\n"));
+    this->begin_row_(PROM_STR("esphome_binary_sensor_value"), metric, out);
+    append(out, obj->state ? PROM_STR("} 1\n") : PROM_STR("} 0\n"));
   } else {
     // Invalid state
-    stream->print(F("esphome_binary_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} 1\n"));
+    append(out, PROM_STR("} 1\n"));
   }
 }
 #endif
 
 #ifdef USE_FAN
-void PrometheusHandler::fan_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_fan_value gauge\n"));
-  stream->print(F("#TYPE esphome_fan_failed gauge\n"));
-  stream->print(F("#TYPE esphome_fan_speed gauge\n"));
-  stream->print(F("#TYPE esphome_fan_oscillation gauge\n"));
-}
-void PrometheusHandler::fan_row_(AsyncResponseStream *stream, fan::Fan *obj) {
-  if (obj->is_internal() && !this->include_internal_)
-    return;
-  stream->print(F("esphome_fan_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} 0\n"));
+void PrometheusHandler::fan_row_(fan::Fan *obj, const Metric &metric, std::string &out) {
+  this->begin_row_(PROM_STR("esphome_fan_failed"), metric, out);
+  append(out, PROM_STR("} 0\n"));
   // Data itself
-  stream->print(F("esphome_fan_value{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} "));
-  stream->print(obj->state);
-  stream->print(F("\n"));
+  this->begin_row_(PROM_STR("esphome_fan_value"), metric, out);
+  append(out, obj->state ? PROM_STR("} 1\n") : PROM_STR("} 0\n"));
   // Speed if available
   if (obj->get_traits().supports_speed()) {
-    stream->print(F("esphome_fan_speed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} "));
-    stream->print(obj->speed);
-    stream->print(F("\n"));
+    this->begin_row_(PROM_STR("esphome_fan_speed"), metric, out);
+    append(out, PROM_STR("} "));
+    append_uint(out, obj->speed);
+    out += '\n';
   }
   // Oscillation if available
   if (obj->get_traits().supports_oscillation()) {
-    stream->print(F("esphome_fan_oscillation{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} "));
-    stream->print(obj->oscillating);
-    stream->print(F("\n"));
+    this->begin_row_(PROM_STR("esphome_fan_oscillation"), metric, out);
+    append(out, obj->oscillating ? PROM_STR("} 1\n") : PROM_STR("} 0\n"));
   }
 }
 #endif
 
 #ifdef USE_LIGHT
-void PrometheusHandler::light_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_light_state gauge\n"));
-  stream->print(F("#TYPE esphome_light_color gauge\n"));
-  stream->print(F("#TYPE esphome_light_effect_active gauge\n"));
-}
-void PrometheusHandler::light_row_(AsyncResponseStream *stream, light::LightState *obj) {
-  if (obj->is_internal() && !this->include_internal_)
-    return;
+void PrometheusHandler::light_row_(light::LightState *obj, const Metric &metric, std::string &out) {
   // State
-  stream->print(F("esphome_light_state{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} "));
-  stream->print(obj->remote_values.is_on());
-  stream->print(F("\n"));
+  this->begin_row_(PROM_STR("esphome_light_state"), metric, out);
+  append(out, obj->remote_values.is_on() ? PROM_STR("} 1\n") : PROM_STR("} 0\n"));
   // Brightness and RGBW
   light::LightColorValues color = obj->current_values;
-  float brightness, r, g, b, w;
-  color.as_brightness(&brightness);
-  color.as_rgbw(&r, &g, &b, &w);
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\",channel=\"brightness\"} "));
-  stream->print(brightness);
-  stream->print(F("\n"));
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\",channel=\"r\"} "));
-  stream->print(r);
-  stream->print(F("\n"));
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\",channel=\"g\"} "));
-  stream->print(g);
-  stream->print(F("\n"));
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\",channel=\"b\"} "));
-  stream->print(b);
-  stream->print(F("\n"));
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\",channel=\"w\"} "));
-  stream->print(w);
-  stream->print(F("\n"));
+  float channels[5];
+  color.as_brightness(&channels[0]);
+  color.as_rgbw(&channels[1], &channels[2], &channels[3], &channels[4]);
+  static const char *const CHANNEL_LABELS[5] = {",channel=\"brightness\"} ", ",channel=\"r\"} ", ",channel=\"g\"} ",
+                                                ",channel=\"b\"} ", ",channel=\"w\"} "};
+  for (uint8_t i = 0; i < 5; i++) {
+    this->begin_row_(PROM_STR("esphome_light_color"), metric, out);
+    out += CHANNEL_LABELS[i];
+    append_float(out, channels[i]);
+    out += '\n';
+  }
   // Effect
   std::string effect = obj->get_effect_name();
+  this->begin_row_(PROM_STR("esphome_light_effect_active"), metric, out);
   if (effect == "None") {
-    stream->print(F("esphome_light_effect_active{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\",effect=\"None\"} 0\n"));
+    append(out, PROM_STR(",effect=\"None\"} 0\n"));
   } else {
-    stream->print(F("esphome_light_effect_active{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\",effect=\""));
-    stream->print(effect.c_str());
-    stream->print(F("\"} 1\n"));
+    append(out, PROM_STR(",effect=\""));
+    append_label_value(out, effect);
+    append(out, PROM_STR("\"} 1\n"));
   }
 }
 #endif
 
 #ifdef USE_COVER
-void PrometheusHandler::cover_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_cover_value gauge\n"));
-  stream->print(F("#TYPE esphome_cover_failed gauge\n"));
-}
-void PrometheusHandler::cover_row_(AsyncResponseStream *stream, cover::Cover *obj) {
-  if (obj->is_internal() && !this->include_internal_)
-    return;
+void PrometheusHandler::cover_row_(cover::Cover *obj, const Metric &metric, std::string &out) {
+  this->begin_row_(PROM_STR("esphome_cover_failed"), metric, out);
   if (!std::isnan(obj->position)) {
     // We have a valid value, output this value
-    stream->print(F("esphome_cover_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} 0\n"));
+    append(out, PROM_STR("} 0\n"));
     // Data itself
-    stream->print(F("esphome_cover_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} "));
-    stream->print(obj->position);
-    stream->print(F("\n"));
+    this->begin_row_(PROM_STR("esphome_cover_value"), metric, out);
+    append(out, PROM_STR("} "));
+    append_float(out, obj->position);
+    out += '\n';
     if (obj->get_traits().get_supports_tilt()) {
-      stream->print(F("esphome_cover_tilt{id=\""));
-      stream->print(relabel_id_(obj).c_str());
-      stream->print(F("\",name=\""));
-      stream->print(relabel_name_(obj).c_str());
-      stream->print(F("\"} "));
-      stream->print(obj->tilt);
-      stream->print(F("\n"));
+      this->begin_row_(PROM_STR("esphome_cover_tilt"), metric, out);
+      append(out, PROM_STR("} "));
+      append_float(out, obj->tilt);
+      out += '\n';
     }
   } else {
     // Invalid state
-    stream->print(F("esphome_cover_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} 1\n"));
+    append(out, PROM_STR("} 1\n"));
   }
 }
 #endif
 
 #ifdef USE_SWITCH
-void PrometheusHandler::switch_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_switch_value gauge\n"));
-  stream->print(F("#TYPE esphome_switch_failed gauge\n"));
-}
-void PrometheusHandler::switch_row_(AsyncResponseStream *stream, switch_::Switch *obj) {
-  if (obj->is_internal() && !this->include_internal_)
-    return;
-  stream->print(F("esphome_switch_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} 0\n"));
+void PrometheusHandler::switch_row_(switch_::Switch *obj, const Metric &metric, std::string &out) {
+  this->begin_row_(PROM_STR("esphome_switch_failed"), metric, out);
+  append(out, PROM_STR("} 0\n"));
   // Data itself
-  stream->print(F("esphome_switch_value{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} "));
-  stream->print(obj->state);
-  stream->print(F("\n"));
+  this->begin_row_(PROM_STR("esphome_switch_value"), metric, out);
+  append(out, obj->state ? PROM_STR("} 1\n") : PROM_STR("} 0\n"));
 }
 #endif
 
 #ifdef USE_LOCK
-void PrometheusHandler::lock_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_lock_value gauge\n"));
-  stream->print(F("#TYPE esphome_lock_failed gauge\n"));
-}
-void PrometheusHandler::lock_row_(AsyncResponseStream *stream, lock::Lock *obj) {
-  if (obj->is_internal() && !this->include_internal_)
-    return;
-  stream->print(F("esphome_lock_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} 0\n"));
+void PrometheusHandler::lock_row_(lock::Lock *obj, const Metric &metric, std::string &out) {
+  this->begin_row_(PROM_STR("esphome_lock_failed"), metric, out);
+  append(out, PROM_STR("} 0\n"));
   // Data itself
-  stream->print(F("esphome_lock_value{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} "));
-  stream->print(obj->state);
-  stream->print(F("\n"));
+  this->begin_row_(PROM_STR("esphome_lock_value"), metric, out);
+  append(out, PROM_STR("} "));
+  append_uint(out, obj->state);
+  out += '\n';
 }
 #endif
 
+void PrometheusHandler::device_rows_(std::string &out) {
+  // longest loop iteration since the previous scrape
+  append(out, PROM_STR("#TYPE esphome_loop_time_max_seconds gauge\n"
+                       "esphome_loop_time_max_seconds "));
+  append_value_accuracy(out, App.get_max_loop_time() / 1000.0f, 3);
+  out += '\n';
+  App.reset_max_loop_time();
+
+#if defined(USE_ESP32) || defined(USE_ESP8266) || defined(USE_LIBRETINY)
+  append(out, PROM_STR("#TYPE esphome_heap_free_bytes gauge\n"
+                       "esphome_heap_free_bytes "));
+#if defined(USE_ESP32)
+  append_uint(out, heap_caps_get_free_size(MALLOC_CAP_INTERNAL));
+#elif defined(USE_ESP8266)
+  append_uint(out, ESP.getFreeHeap());  // NOLINT(readability-static-accessed-through-instance)
+#elif defined(USE_LIBRETINY)
+  append_uint(out, lt_heap_get_free());
+#endif
+  out += '\n';
+#endif
+#if defined(USE_ESP32) || defined(USE_ESP8266)
+  append(out, PROM_STR("#TYPE esphome_heap_max_free_block_bytes gauge\n"
+                       "esphome_heap_max_free_block_bytes "));
+#if defined(USE_ESP32)
+  append_uint(out, heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL));
+#else
+  append_uint(out, ESP.getMaxFreeBlockSize());  // NOLINT(readability-static-accessed-through-instance)
+#endif
+  out += '\n';
+#endif
+}
+
 }  // namespace prometheus
 }  // namespace esphome
 #endif
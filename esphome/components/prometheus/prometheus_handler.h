@@ -2,7 +2,9 @@
 #include "esphome/core/defines.h"
 #ifdef USE_NETWORK
 #include <map>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "esphome/components/web_server_base/web_server_base.h"
 #include "esphome/core/component.h"
@@ -48,72 +50,91 @@ class PrometheusHandler : public AsyncWebHandler, public Component {
 
   void handleRequest(AsyncWebServerRequest *req) override;
 
-  void setup() override {
-    this->base_->init();
-    this->base_->add_handler(this);
-  }
+  void setup() override;
   float get_setup_priority() const override {
     // After WiFi
     return setup_priority::WIFI - 1.0f;
   }
 
  protected:
-  std::string relabel_id_(EntityBase *obj);
-  std::string relabel_name_(EntityBase *obj);
+  /// Sections of the response, in output order.
+  enum Section : uint8_t {
+    SECTION_SENSOR = 0,
+    SECTION_BINARY_SENSOR,
+    SECTION_FAN,
+    SECTION_LIGHT,
+    SECTION_COVER,
+    SECTION_SWITCH,
+    SECTION_LOCK,
+    SECTION_DEVICE,
+    SECTION_COUNT,
+  };
+
+  /// An exported entity with its labels, precomputed at setup.
+  struct Metric {
+    EntityBase *obj;
+    /// Offset of `id="...",name="..."` in labels_.
+    uint32_t labels_offset;
+    uint16_t labels_length;
+    /// Length of the `,unit="..."` label of sensors, which directly follows the other labels.
+    uint16_t unit_length;
+    Section section;
+  };
+
+  /// Position of a response that is being sent.
+  struct Scrape {
+    uint8_t section{0};
+    /// 0 for the type header of the section, otherwise the metric in the section plus one.
+    uint16_t index{0};
+    /// Rows that were generated but didn't fit into the last chunk yet.
+    std::string pending;
+    size_t pending_position{0};
+  };
+
+  void add_metric_(Section section, EntityBase *obj, const std::string *unit = nullptr);
+  /// Fill \p buffer with the next part of the response, returns 0 at the end.
+  size_t fill_(Scrape &scrape, uint8_t *buffer, size_t max_length);
+  /// Append the next part (a type header or the rows of one entity) to \p out, returns false at the end.
+  bool write_next_(Scrape &scrape, std::string &out);
+  void write_type_(Section section, std::string &out);
+  void write_row_(Section section, const Metric &metric, std::string &out);
+  /// Append the metric name and the labels of the entity, without the closing brace.
+  void begin_row_(const char *name, const Metric &metric, std::string &out, bool with_unit = false);
 
 #ifdef USE_SENSOR
-  /// Return the type for prometheus
-  void sensor_type_(AsyncResponseStream *stream);
-  /// Return the sensor state as prometheus data point
-  void sensor_row_(AsyncResponseStream *stream, sensor::Sensor *obj);
+  void sensor_row_(sensor::Sensor *obj, const Metric &metric, std::string &out);
 #endif
-
 #ifdef USE_BINARY_SENSOR
-  /// Return the type for prometheus
-  void binary_sensor_type_(AsyncResponseStream *stream);
-  /// Return the sensor state as prometheus data point
-  void binary_sensor_row_(AsyncResponseStream *stream, binary_sensor::BinarySensor *obj);
+  void binary_sensor_row_(binary_sensor::BinarySensor *obj, const Metric &metric, std::string &out);
 #endif
-
 #ifdef USE_FAN
-  /// Return the type for prometheus
-  void fan_type_(AsyncResponseStream *stream);
-  /// Return the sensor state as prometheus data point
-  void fan_row_(AsyncResponseStream *stream, fan::Fan *obj);
+  void fan_row_(fan::Fan *obj, const Metric &metric, std::string &out);
 #endif
-
 #ifdef USE_LIGHT
-  /// Return the type for prometheus
-  void light_type_(AsyncResponseStream *stream);
-  /// Return the Light Values state as prometheus data point
-  void light_row_(AsyncResponseStream *stream, light::LightState *obj);
+  void light_row_(light::LightState *obj, const Metric &metric, std::string &out);
 #endif
-
 #ifdef USE_COVER
-  /// Return the type for prometheus
-  void cover_type_(AsyncResponseStream *stream);
-  /// Return the switch Values state as prometheus data point
-  void cover_row_(AsyncResponseStream *stream, cover::Cover *obj);
+  void cover_row_(cover::Cover *obj, const Metric &metric, std::string &out);
 #endif
-
 #ifdef USE_SWITCH
-  /// Return the type for prometheus
-  void switch_type_(AsyncResponseStream *stream);
-  /// Return the switch Values state as prometheus data point
-  void switch_row_(AsyncResponseStream *stream, switch_::Switch *obj);
+  void switch_row_(switch_::Switch *obj, const Metric &metric, std::string &out);
 #endif
-
 #ifdef USE_LOCK
-  /// Return the type for prometheus
-  void lock_type_(AsyncResponseStream *stream);
-  /// Return the lock Values state as prometheus data point
-  void lock_row_(AsyncResponseStream *stream, lock::Lock *obj);
+  void lock_row_(lock::Lock *obj, const Metric &metric, std::string &out);
 #endif
+  void device_rows_(std::string &out);
 
   web_server_base::WebServerBase *base_;
   bool include_internal_{false};
+  /// Only used until setup() precomputed the labels.
   std::map<EntityBase *, std::string> relabel_map_id_;
   std::map<EntityBase *, std::string> relabel_map_name_;
+  /// Labels of all metrics, in one allocation.
+  std::string labels_;
+  /// Exported entities, ordered by section.
+  std::vector<Metric> metrics_;
+  /// Index of the first metric of each section in metrics_.
+  uint16_t section_start_[SECTION_COUNT + 1]{};
 };
 
 }  // namespace prometheus
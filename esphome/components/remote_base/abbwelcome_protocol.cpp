@@ -77,6 +77,8 @@ bool ABBWelcomeProtocol::decode_byte_(RemoteReceiveData &src, bool &done, uint8_
   return true;
 }
 
+RemoteLeader ABBWelcomeProtocol::get_leader() const { return {BIT_ZERO_MARK_US, BIT_ZERO_SPACE_US}; }
+
 optional<ABBWelcomeData> ABBWelcomeProtocol::decode(RemoteReceiveData src) {
   if (src.expect_item(BIT_ZERO_MARK_US, BIT_ZERO_SPACE_US) &&
       src.expect_item(BIT_ZERO_MARK_US, BIT_ZERO_SPACE_US + BIT_ONE_SPACE_US) &&
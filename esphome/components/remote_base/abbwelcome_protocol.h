@@ -181,6 +181,7 @@ class ABBWelcomeProtocol : public RemoteProtocol<ABBWelcomeData> {
   void encode(RemoteTransmitData *dst, const ABBWelcomeData &src) override;
   optional<ABBWelcomeData> decode(RemoteReceiveData src) override;
   void dump(const ABBWelcomeData &data) override;
+  RemoteLeader get_leader() const override;
 
  protected:
   void encode_byte_(RemoteTransmitData *dst, uint8_t data) const;
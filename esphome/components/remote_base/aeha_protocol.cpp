@@ -40,6 +40,8 @@ void AEHAProtocol::encode(RemoteTransmitData *dst, const AEHAData &data) {
 
   dst->mark(TRAILER);
 }
+RemoteLeader AEHAProtocol::get_leader() const { return {HEADER_HIGH_US, HEADER_LOW_US}; }
+
 optional<AEHAData> AEHAProtocol::decode(RemoteReceiveData src) {
   AEHAData out{
       .address = 0,
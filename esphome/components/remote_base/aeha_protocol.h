@@ -19,6 +19,7 @@ class AEHAProtocol : public RemoteProtocol<AEHAData> {
   void encode(RemoteTransmitData *dst, const AEHAData &data) override;
   optional<AEHAData> decode(RemoteReceiveData src) override;
   void dump(const AEHAData &data) override;
+  RemoteLeader get_leader() const override;
 
  private:
   std::string format_data_(const std::vector<uint8_t> &data);
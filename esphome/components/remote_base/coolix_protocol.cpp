@@ -89,6 +89,8 @@ static bool decode_frame(RemoteReceiveData &src, uint32_t &dst) {
   }
 }
 
+RemoteLeader CoolixProtocol::get_leader() const { return {HEADER_MARK_US, HEADER_SPACE_US}; }
+
 optional<CoolixData> CoolixProtocol::decode(RemoteReceiveData data) {
   CoolixData result;
   const auto size = data.size();
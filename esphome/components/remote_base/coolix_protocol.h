@@ -25,6 +25,7 @@ class CoolixProtocol : public RemoteProtocol<CoolixData> {
   void encode(RemoteTransmitData *dst, const CoolixData &data) override;
   optional<CoolixData> decode(RemoteReceiveData data) override;
   void dump(const CoolixData &data) override;
+  RemoteLeader get_leader() const override;
 };
 
 DECLARE_REMOTE_PROTOCOL(Coolix)
@@ -47,6 +47,8 @@ void DishProtocol::encode(RemoteTransmitData *dst, const DishData &data) {
     dst->item(HEADER_HIGH_US, HEADER_LOW_US);
   }
 }
+RemoteLeader DishProtocol::get_leader() const { return {HEADER_HIGH_US, HEADER_LOW_US}; }
+
 optional<DishData> DishProtocol::decode(RemoteReceiveData src) {
   DishData data{
       .address = 0,
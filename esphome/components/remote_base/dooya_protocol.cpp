@@ -51,6 +51,8 @@ void DooyaProtocol::encode(RemoteTransmitData *dst, const DooyaData &data) {
     }
   }
 }
+RemoteLeader DooyaProtocol::get_leader() const { return {HEADER_HIGH_US, HEADER_LOW_US}; }
+
 optional<DooyaData> DooyaProtocol::decode(RemoteReceiveData src) {
   DooyaData out{
       .id = 0,
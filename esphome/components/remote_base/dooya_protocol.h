@@ -24,6 +24,7 @@ class DooyaProtocol : public RemoteProtocol<DooyaData> {
   void encode(RemoteTransmitData *dst, const DooyaData &data) override;
   optional<DooyaData> decode(RemoteReceiveData src) override;
   void dump(const DooyaData &data) override;
+  RemoteLeader get_leader() const override;
 };
 
 DECLARE_REMOTE_PROTOCOL(Dooya)
@@ -40,6 +40,8 @@ void HaierProtocol::encode(RemoteTransmitData *dst, const HaierData &data) {
   this->encode_byte_(dst, checksum);
 }
 
+RemoteLeader HaierProtocol::get_leader() const { return {HEADER_LOW_US, HEADER_LOW_US}; }
+
 optional<HaierData> HaierProtocol::decode(RemoteReceiveData src) {
   if (!src.expect_item(HEADER_LOW_US, HEADER_LOW_US) || !src.expect_item(HEADER_LOW_US, HEADER_HIGH_US)) {
     return {};
@@ -17,6 +17,7 @@ class HaierProtocol : public RemoteProtocol<HaierData> {
   void encode(RemoteTransmitData *dst, const HaierData &data) override;
   optional<HaierData> decode(RemoteReceiveData src) override;
   void dump(const HaierData &data) override;
+  RemoteLeader get_leader() const override;
 
  protected:
   void encode_byte_(RemoteTransmitData *dst, uint8_t item);
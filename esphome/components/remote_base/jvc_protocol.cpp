@@ -29,6 +29,8 @@ void JVCProtocol::encode(RemoteTransmitData *dst, const JVCData &data) {
 
   dst->mark(BIT_HIGH_US);
 }
+RemoteLeader JVCProtocol::get_leader() const { return {HEADER_HIGH_US, HEADER_LOW_US}; }
+
 optional<JVCData> JVCProtocol::decode(RemoteReceiveData src) {
   JVCData out{.data = 0};
   if (!src.expect_item(HEADER_HIGH_US, HEADER_LOW_US))
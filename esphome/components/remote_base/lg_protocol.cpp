@@ -28,6 +28,8 @@ void LGProtocol::encode(RemoteTransmitData *dst, const LGData &data) {
 
   dst->mark(BIT_HIGH_US);
 }
+RemoteLeader LGProtocol::get_leader() const { return {HEADER_HIGH_US, HEADER_LOW_US}; }
+
 optional<LGData> LGProtocol::decode(RemoteReceiveData src) {
   LGData out{
       .data = 0,
@@ -20,6 +20,7 @@ class LGProtocol : public RemoteProtocol<LGData> {
   void encode(RemoteTransmitData *dst, const LGData &data) override;
   optional<LGData> decode(RemoteReceiveData src) override;
   void dump(const LGData &data) override;
+  RemoteLeader get_leader() const override;
 };
 
 DECLARE_REMOTE_PROTOCOL(LG)
@@ -41,6 +41,8 @@ void MagiQuestProtocol::encode(RemoteTransmitData *dst, const MagiQuestData &dat
 
   dst->mark(MAGIQUEST_UNIT);
 }
+RemoteLeader MagiQuestProtocol::get_leader() const { return {MAGIQUEST_ZERO_MARK, MAGIQUEST_ZERO_SPACE}; }
+
 optional<MagiQuestData> MagiQuestProtocol::decode(RemoteReceiveData src) {
   MagiQuestData data{
       .magnitude = 0,
@@ -31,6 +31,7 @@ class MagiQuestProtocol : public RemoteProtocol<MagiQuestData> {
   void encode(RemoteTransmitData *dst, const MagiQuestData &data) override;
   optional<MagiQuestData> decode(RemoteReceiveData src) override;
   void dump(const MagiQuestData &data) override;
+  RemoteLeader get_leader() const override;
 };
 
 DECLARE_REMOTE_PROTOCOL(MagiQuest)
@@ -40,6 +40,8 @@ void MirageProtocol::encode_byte_(RemoteTransmitData *dst, uint8_t item) {
   }
 }
 
+RemoteLeader MirageProtocol::get_leader() const { return {HEADER_MARK_US, HEADER_SPACE_US}; }
+
 optional<MirageData> MirageProtocol::decode(RemoteReceiveData src) {
   if (!src.expect_item(HEADER_MARK_US, HEADER_SPACE_US)) {
     return {};
@@ -41,6 +41,8 @@ void NECProtocol::encode(RemoteTransmitData *dst, const NECData &data) {
 
   dst->mark(BIT_HIGH_US);
 }
+RemoteLeader NECProtocol::get_leader() const { return {HEADER_HIGH_US, HEADER_LOW_US}; }
+
 optional<NECData> NECProtocol::decode(RemoteReceiveData src) {
   NECData data{
       .address = 0,
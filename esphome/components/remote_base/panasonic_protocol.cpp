@@ -35,6 +35,8 @@ void PanasonicProtocol::encode(RemoteTransmitData *dst, const PanasonicData &dat
   }
   dst->mark(BIT_HIGH_US);
 }
+RemoteLeader PanasonicProtocol::get_leader() const { return {HEADER_HIGH_US, HEADER_LOW_US}; }
+
 optional<PanasonicData> PanasonicProtocol::decode(RemoteReceiveData src) {
   PanasonicData out{
       .address = 0,
@@ -91,6 +91,8 @@ void PioneerProtocol::encode(RemoteTransmitData *dst, const PioneerData &data) {
     dst->mark(BIT_HIGH_US);
   }
 }
+RemoteLeader PioneerProtocol::get_leader() const { return {HEADER_HIGH_US, HEADER_LOW_US}; }
+
 optional<PioneerData> PioneerProtocol::decode(RemoteReceiveData src) {
   uint16_t address1 = 0;
   uint16_t command1 = 0;
@@ -35,7 +35,7 @@ class RawBinarySensor : public RemoteReceiverBinarySensorBase {
 class RawTrigger : public Trigger<RawTimings>, public Component, public RemoteReceiverListener {
  protected:
   bool on_receive(RemoteReceiveData src) override {
-    this->trigger(src.get_raw_data());
+    this->trigger(src.get_raw_data().to_raw());
     return false;
   }
 };
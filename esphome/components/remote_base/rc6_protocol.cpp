@@ -105,6 +105,8 @@ void RC6Protocol::encode(RemoteTransmitData *dst, const RC6Data &data) {
   }
 }
 
+RemoteLeader RC6Protocol::get_leader() const { return {RC6_HEADER_MARK, RC6_HEADER_SPACE}; }
+
 optional<RC6Data> RC6Protocol::decode(RemoteReceiveData src) {
   RC6Data data{
       .mode = 0,
@@ -100,26 +100,32 @@ bool RemoteReceiverBinarySensorBase::on_receive(RemoteReceiveData src) {
 
 void RemoteReceiverBase::register_dumper(RemoteReceiverDumperBase *dumper) {
   if (dumper->is_secondary()) {
-    this->secondary_dumpers_.push_back(dumper);
+    this->secondary_dumpers_.push_back({dumper->get_leader(), dumper});
   } else {
-    this->dumpers_.push_back(dumper);
+    this->dumpers_.push_back({dumper->get_leader(), dumper});
   }
 }
 
 void RemoteReceiverBase::call_listeners_() {
-  for (auto *listener : this->listeners_)
-    listener->on_receive(RemoteReceiveData(this->temp_, this->tolerance_, this->tolerance_mode_));
+  const RemoteReceiveData src(this->temp_, this->tolerance_, this->tolerance_mode_, this->frame_);
+  for (auto &listener : this->listeners_) {
+    if (src.matches_leader(listener.leader))
+      listener.handler->on_receive(src);
+  }
 }
 
 void RemoteReceiverBase::call_dumpers_() {
+  const RemoteReceiveData src(this->temp_, this->tolerance_, this->tolerance_mode_, this->frame_);
   bool success = false;
-  for (auto *dumper : this->dumpers_) {
-    if (dumper->dump(RemoteReceiveData(this->temp_, this->tolerance_, this->tolerance_mode_)))
+  for (auto &dumper : this->dumpers_) {
+    if (src.matches_leader(dumper.leader) && dumper.handler->dump(src))
       success = true;
   }
   if (!success) {
-    for (auto *dumper : this->secondary_dumpers_)
-      dumper->dump(RemoteReceiveData(this->temp_, this->tolerance_, this->tolerance_mode_));
+    for (auto &dumper : this->secondary_dumpers_) {
+      if (src.matches_leader(dumper.leader))
+        dumper.handler->dump(src);
+    }
   }
 }
 
@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
 #include <utility>
 #include <vector>
 
@@ -22,6 +25,78 @@ enum ToleranceMode : uint8_t {
 
 using RawTimings = std::vector<int32_t>;
 
+/** Durations of marks (positive) and spaces (negative) in microseconds, stored in 16 bits each.
+ *
+ * Durations below 16384us are stored exactly, longer ones (like the gap after a frame) in steps of 64us up to about
+ * one second. Values are unpacked on access, so it's indexed and iterated like RawTimings with half the memory.
+ */
+class PackedTimings {
+ public:
+  class Iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = int32_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = int32_t;
+
+    explicit Iterator(const int16_t *value) : value_(value) {}
+    int32_t operator*() const { return PackedTimings::unpack(*this->value_); }
+    Iterator &operator++() {
+      this->value_++;
+      return *this;
+    }
+    bool operator==(const Iterator &other) const { return this->value_ == other.value_; }
+    bool operator!=(const Iterator &other) const { return this->value_ != other.value_; }
+
+   protected:
+    const int16_t *value_;
+  };
+
+  static int16_t pack(int32_t value) {
+    int32_t length = value < 0 ? -value : value;
+    if (length >= EXACT_LIMIT)
+      length = EXACT_LIMIT + std::min((length - EXACT_LIMIT + (1 << (COARSE_SHIFT - 1))) >> COARSE_SHIFT,
+                                      EXACT_LIMIT - 1);
+    return value < 0 ? -int16_t(length) : int16_t(length);
+  }
+  static int32_t unpack(int16_t value) {
+    int32_t length = value < 0 ? -int32_t(value) : value;
+    if (length >= EXACT_LIMIT)
+      length = EXACT_LIMIT + ((length - EXACT_LIMIT) << COARSE_SHIFT);
+    return value < 0 ? -length : length;
+  }
+
+  int32_t operator[](size_t index) const { return unpack(this->data_[index]); }
+  size_t size() const { return this->data_.size(); }
+  bool empty() const { return this->data_.empty(); }
+  void clear() { this->data_.clear(); }
+  void reserve(size_t size) { this->data_.reserve(size); }
+  void push_back(int32_t value) { this->data_.push_back(pack(value)); }
+  void assign(const RawTimings &timings) {
+    this->data_.clear();
+    this->data_.reserve(timings.size());
+    for (int32_t value : timings)
+      this->data_.push_back(pack(value));
+  }
+  Iterator begin() const { return Iterator(this->data_.data()); }
+  Iterator end() const { return Iterator(this->data_.data() + this->data_.size()); }
+  /// Unpacked copy, for automations.
+  RawTimings to_raw() const { return RawTimings(this->begin(), this->end()); }
+
+ protected:
+  static constexpr int32_t EXACT_LIMIT = 1 << 14;
+  static constexpr uint8_t COARSE_SHIFT = 6;
+
+  std::vector<int16_t> data_;
+};
+
+/// First mark and space that every frame of a protocol starts with. A zero mark matches any frame.
+struct RemoteLeader {
+  uint32_t mark;
+  uint32_t space;
+};
+
 class RemoteTransmitData {
  public:
   void mark(uint32_t length) { this->data_.push_back(length); }
@@ -33,25 +108,28 @@ class RemoteTransmitData {
   void reserve(uint32_t len) { this->data_.reserve(len); }
   void set_carrier_frequency(uint32_t carrier_frequency) { this->carrier_frequency_ = carrier_frequency; }
   uint32_t get_carrier_frequency() const { return this->carrier_frequency_; }
-  const RawTimings &get_data() const { return this->data_; }
-  void set_data(const RawTimings &data) { this->data_ = data; }
+  const PackedTimings &get_data() const { return this->data_; }
+  void set_data(const RawTimings &data) { this->data_.assign(data); }
   void reset() {
     this->data_.clear();
     this->carrier_frequency_ = 0;
   }
 
  protected:
-  RawTimings data_{};
+  PackedTimings data_{};
   uint32_t carrier_frequency_{0};
 };
 
 class RemoteReceiveData {
  public:
-  explicit RemoteReceiveData(const RawTimings &data, uint32_t tolerance, ToleranceMode tolerance_mode)
-      : data_(data), index_(0), tolerance_(tolerance), tolerance_mode_(tolerance_mode) {}
+  explicit RemoteReceiveData(const PackedTimings &data, uint32_t tolerance, ToleranceMode tolerance_mode,
+                             uint32_t frame = 0)
+      : data_(data), index_(0), tolerance_(tolerance), tolerance_mode_(tolerance_mode), frame_(frame) {}
 
-  const RawTimings &get_raw_data() const { return this->data_; }
+  const PackedTimings &get_raw_data() const { return this->data_; }
   uint32_t get_index() const { return index_; }
+  /// Number of the received frame, to tell frames apart. 0 if unknown.
+  uint32_t get_frame() const { return this->frame_; }
   int32_t operator[](uint32_t index) const { return this->data_[index]; }
   int32_t size() const { return this->data_.size(); }
   bool is_valid(uint32_t offset) const { return this->index_ + offset < this->data_.size(); }
@@ -63,6 +141,11 @@ class RemoteReceiveData {
     return this->peek_space(space, offset + 1) && this->peek_mark(mark, offset);
   }
 
+  /// Whether the data starts with \p leader.
+  bool matches_leader(const RemoteLeader &leader) const {
+    return leader.mark == 0 || (this->peek_mark(leader.mark, 0) && this->peek_space(leader.space, 1));
+  }
+
   bool expect_mark(uint32_t length);
   bool expect_space(uint32_t length);
   bool expect_item(uint32_t mark, uint32_t space);
@@ -95,10 +178,11 @@ class RemoteReceiveData {
     return 0;
   }
 
-  const RawTimings &data_;
+  const PackedTimings &data_;
   uint32_t index_;
   uint32_t tolerance_;
   ToleranceMode tolerance_mode_;
+  uint32_t frame_;
 };
 
 class RemoteComponentBase {
@@ -176,18 +260,24 @@ class RemoteTransmitterBase : public RemoteComponentBase {
 class RemoteReceiverListener {
  public:
   virtual bool on_receive(RemoteReceiveData data) = 0;
+  /// Frames not starting with this leader are not passed to on_receive().
+  virtual RemoteLeader get_leader() { return {0, 0}; }
 };
 
 class RemoteReceiverDumperBase {
  public:
   virtual bool dump(RemoteReceiveData src) = 0;
   virtual bool is_secondary() { return false; }
+  /// Frames not starting with this leader are not passed to dump().
+  virtual RemoteLeader get_leader() { return {0, 0}; }
 };
 
 class RemoteReceiverBase : public RemoteComponentBase {
  public:
   RemoteReceiverBase(InternalGPIOPin *pin) : RemoteComponentBase(pin) {}
-  void register_listener(RemoteReceiverListener *listener) { this->listeners_.push_back(listener); }
+  void register_listener(RemoteReceiverListener *listener) {
+    this->listeners_.push_back({listener->get_leader(), listener});
+  }
   void register_dumper(RemoteReceiverDumperBase *dumper);
   void set_tolerance(uint32_t tolerance, ToleranceMode tolerance_mode) {
     this->tolerance_ = tolerance;
@@ -198,14 +288,24 @@ class RemoteReceiverBase : public RemoteComponentBase {
   void call_listeners_();
   void call_dumpers_();
   void call_listeners_dumpers_() {
+    if (++this->frame_ == 0)
+      this->frame_ = 1;
     this->call_listeners_();
     this->call_dumpers_();
   }
 
-  std::vector<RemoteReceiverListener *> listeners_;
-  std::vector<RemoteReceiverDumperBase *> dumpers_;
-  std::vector<RemoteReceiverDumperBase *> secondary_dumpers_;
-  RawTimings temp_;
+  /// Listeners and dumpers with the leader of their protocol, so a frame is only decoded by the protocols that can
+  /// match its first mark and space.
+  template<typename T> struct Entry {
+    RemoteLeader leader;
+    T *handler;
+  };
+
+  std::vector<Entry<RemoteReceiverListener>> listeners_;
+  std::vector<Entry<RemoteReceiverDumperBase>> dumpers_;
+  std::vector<Entry<RemoteReceiverDumperBase>> secondary_dumpers_;
+  PackedTimings temp_;
+  uint32_t frame_{0};
   uint32_t tolerance_{25};
   ToleranceMode tolerance_mode_{TOLERANCE_MODE_PERCENTAGE};
 };
@@ -228,21 +328,40 @@ template<typename T> class RemoteProtocol {
   virtual void encode(RemoteTransmitData *dst, const ProtocolData &data) = 0;
   virtual optional<ProtocolData> decode(RemoteReceiveData src) = 0;
   virtual void dump(const ProtocolData &data) = 0;
+  /// Leader that decode() requires at the start of every frame, if there is one.
+  virtual RemoteLeader get_leader() const { return {0, 0}; }
 };
 
+/** Decode \p src with protocol T.
+ *
+ * The result is kept until the next frame, so a frame is decoded only once for all listeners and dumpers of a
+ * protocol (like a binary sensor per button of a remote).
+ */
+template<typename T> const optional<typename T::ProtocolData> &decode_cached(RemoteReceiveData src) {
+  static const PackedTimings *last_data = nullptr;
+  static uint32_t last_frame = 0;
+  static optional<typename T::ProtocolData> result;
+  if (src.get_frame() == 0 || src.get_frame() != last_frame || &src.get_raw_data() != last_data) {
+    result = T().decode(src);
+    last_frame = src.get_frame();
+    last_data = &src.get_raw_data();
+  }
+  return result;
+}
+
 template<typename T> class RemoteReceiverBinarySensor : public RemoteReceiverBinarySensorBase {
  public:
   RemoteReceiverBinarySensor() : RemoteReceiverBinarySensorBase() {}
 
  protected:
   bool matches(RemoteReceiveData src) override {
-    auto proto = T();
-    auto res = proto.decode(src);
+    const auto &res = decode_cached<T>(src);
     return res.has_value() && *res == this->data_;
   }
 
  public:
   void set_data(typename T::ProtocolData data) { data_ = data; }
+  RemoteLeader get_leader() override { return T().get_leader(); }
 
  protected:
   typename T::ProtocolData data_;
@@ -250,10 +369,12 @@ template<typename T> class RemoteReceiverBinarySensor : public RemoteReceiverBin
 
 template<typename T>
 class RemoteReceiverTrigger : public Trigger<typename T::ProtocolData>, public RemoteReceiverListener {
+ public:
+  RemoteLeader get_leader() override { return T().get_leader(); }
+
  protected:
   bool on_receive(RemoteReceiveData src) override {
-    auto proto = T();
-    auto res = proto.decode(src);
+    const auto &res = decode_cached<T>(src);
     if (res.has_value()) {
       this->trigger(*res);
       return true;
@@ -294,13 +415,13 @@ template<typename... Ts> class RemoteTransmitterActionBase : public RemoteTransm
 template<typename T> class RemoteReceiverDumper : public RemoteReceiverDumperBase {
  public:
   bool dump(RemoteReceiveData src) override {
-    auto proto = T();
-    auto decoded = proto.decode(src);
+    const auto &decoded = decode_cached<T>(src);
     if (!decoded.has_value())
       return false;
-    proto.dump(*decoded);
+    T().dump(*decoded);
     return true;
   }
+  RemoteLeader get_leader() override { return T().get_leader(); }
 };
 
 #define DECLARE_REMOTE_PROTOCOL_(prefix) \
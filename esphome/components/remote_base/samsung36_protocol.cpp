@@ -50,6 +50,8 @@ void Samsung36Protocol::encode(RemoteTransmitData *dst, const Samsung36Data &dat
   dst->item(FOOTER_HIGH_US, FOOTER_LOW_US);
 }
 
+RemoteLeader Samsung36Protocol::get_leader() const { return {HEADER_HIGH_US, HEADER_LOW_US}; }
+
 optional<Samsung36Data> Samsung36Protocol::decode(RemoteReceiveData src) {
   Samsung36Data out{
       .address = 0,
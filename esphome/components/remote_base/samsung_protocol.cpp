@@ -31,6 +31,8 @@ void SamsungProtocol::encode(RemoteTransmitData *dst, const SamsungData &data) {
 
   dst->item(FOOTER_HIGH_US, FOOTER_LOW_US);
 }
+RemoteLeader SamsungProtocol::get_leader() const { return {HEADER_HIGH_US, HEADER_LOW_US}; }
+
 optional<SamsungData> SamsungProtocol::decode(RemoteReceiveData src) {
   SamsungData out{
       .data = 0,
@@ -26,6 +26,8 @@ void SonyProtocol::encode(RemoteTransmitData *dst, const SonyData &data) {
     }
   }
 }
+RemoteLeader SonyProtocol::get_leader() const { return {HEADER_HIGH_US, HEADER_LOW_US}; }
+
 optional<SonyData> SonyProtocol::decode(RemoteReceiveData src) {
   SonyData out{
       .data = 0,
@@ -47,6 +47,8 @@ void ToshibaAcProtocol::encode(RemoteTransmitData *dst, const ToshibaAcData &dat
   }
 }
 
+RemoteLeader ToshibaAcProtocol::get_leader() const { return {HEADER_HIGH_US, HEADER_LOW_US}; }
+
 optional<ToshibaAcData> ToshibaAcProtocol::decode(RemoteReceiveData src) {
   uint64_t packet = 0;
   ToshibaAcData out{
@@ -18,6 +18,7 @@ class ToshibaAcProtocol : public RemoteProtocol<ToshibaAcData> {
   void encode(RemoteTransmitData *dst, const ToshibaAcData &data) override;
   optional<ToshibaAcData> decode(RemoteReceiveData src) override;
   void dump(const ToshibaAcData &data) override;
+  RemoteLeader get_leader() const override;
 };
 
 DECLARE_REMOTE_PROTOCOL(ToshibaAc)
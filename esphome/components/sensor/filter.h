@@ -1,5 +1,8 @@
 #pragma once
 
+#include <algorithm>
+#include <cmath>
+#include <functional>
 #include <queue>
 #include <utility>
 #include <vector>
@@ -43,6 +46,93 @@ class Filter {
   Sensor *parent_{nullptr};
 };
 
+/** The values of a sliding window, both in arrival order and sorted.
+ *
+ * The arrival order is kept in a ring of window_size values. A value entering or leaving the window is inserted into
+ * or removed from the sorted values by binary search, so picking an order statistic needs no copy or sort of the
+ * window. NaN values take up a place in the window, but are left out of the sorted values.
+ */
+class SortedWindow {
+ public:
+  explicit SortedWindow(size_t window_size) { this->set_window_size(window_size); }
+
+  void push(float value);
+  void set_window_size(size_t window_size);
+
+  /// The values in the window that aren't NaN, in ascending order.
+  const std::vector<float> &sorted() const { return this->sorted_; }
+
+ protected:
+  void remove_sorted_(float value);
+
+  std::vector<float> values_;
+  std::vector<float> sorted_;
+  size_t oldest_{0};
+  size_t capacity_{1};
+};
+
+/** The extreme of a sliding window in amortized constant time.
+ *
+ * Only values that can still become the extreme are kept: a new value drops all kept values it beats, so the oldest
+ * kept value is the extreme of the window. Ties keep the older value, like a scan of the window would. NaN values
+ * are skipped.
+ *
+ * @tparam Compare std::less<float> for the minimum, std::greater<float> for the maximum.
+ */
+template<typename Compare> class MonotonicWindow {
+ public:
+  explicit MonotonicWindow(size_t window_size) { this->set_window_size(window_size); }
+
+  void push(float value) {
+    this->index_++;
+    this->expire_();
+    if (std::isnan(value))
+      return;
+    while (this->count_ != 0 && Compare()(value, this->entries_[this->slot_(this->count_ - 1)].value))
+      this->count_--;
+    this->entries_[this->slot_(this->count_)] = {this->index_, value};
+    this->count_++;
+  }
+
+  /// The extreme of the window, NaN if it only holds NaN values.
+  float extreme() const { return this->count_ == 0 ? NAN : this->entries_[this->head_].value; }
+
+  void set_window_size(size_t window_size) {
+    this->window_size_ = std::max<size_t>(window_size, 1);
+    this->expire_();
+    std::vector<Entry> entries(this->window_size_);
+    for (size_t i = 0; i < this->count_; i++)
+      entries[i] = this->entries_[this->slot_(i)];
+    this->entries_ = std::move(entries);
+    this->head_ = 0;
+  }
+
+ protected:
+  struct Entry {
+    size_t index;
+    float value;
+  };
+
+  /// Position of the i-th kept value in the ring.
+  size_t slot_(size_t i) const {
+    size_t slot = this->head_ + i;
+    return slot < this->entries_.size() ? slot : slot - this->entries_.size();
+  }
+  /// Drop kept values that are no longer in the window, the difference of the indices is safe against wrapping.
+  void expire_() {
+    while (this->count_ != 0 && this->index_ - this->entries_[this->head_].index >= this->window_size_) {
+      this->head_ = this->slot_(1);
+      this->count_--;
+    }
+  }
+
+  std::vector<Entry> entries_;
+  size_t head_{0};
+  size_t count_{0};
+  size_t index_{0};
+  size_t window_size_{1};
+};
+
 /** Simple quantile filter.
  *
  * Takes the quantile of the last <send_every> values and pushes it out every <send_every>.
@@ -67,10 +157,9 @@ class QuantileFilter : public Filter {
   void set_quantile(float quantile);
 
  protected:
-  std::deque<float> queue_;
+  SortedWindow window_;
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
   float quantile_;
 };
 
@@ -96,10 +185,9 @@ class MedianFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  SortedWindow window_;
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
 };
 
 /** Simple skip filter.
@@ -142,10 +230,9 @@ class MinFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  MonotonicWindow<std::less<float>> window_;
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
 };
 
 /** Simple max filter.
@@ -170,10 +257,9 @@ class MaxFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  MonotonicWindow<std::greater<float>> window_;
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
 };
 
 /** Simple sliding window moving average filter.
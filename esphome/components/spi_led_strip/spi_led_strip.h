@@ -81,6 +81,7 @@ class SpiLedStrip : public light::AddressableLight,
     return {this->buf_ + pos + 2,       this->buf_ + pos + 1, this->buf_ + pos + 0, nullptr,
             this->effect_data_ + index, &this->correction_};
   }
+  int32_t get_stride_internal() const override { return 4; }
 
   size_t buffer_size_{};
   uint8_t *effect_data_{nullptr};
@@ -183,40 +183,53 @@ void SSD1306::setup() {
     set_brightness(this->brightness_);
 
   this->fill(Color::BLACK);  // clear display - ensures we do not see garbage at power-on
-  this->display();           // ...write buffer, which actually clears the display's memory
+  this->mark_all_dirty_();
+  this->display();  // ...write buffer, which actually clears the display's memory
 
   this->turn_on();
 }
 void SSD1306::display() {
+  // nothing changed since the last transfer
+  if (this->get_dirty_count_() == 0)
+    return;
+
   if (this->is_sh1106_() || this->is_sh1107_()) {
     this->write_display_data();
+    this->clear_dirty_();
     return;
   }
 
-  this->command(SSD1306_COMMAND_COLUMN_ADDRESS);
+  uint8_t column_offset = this->offset_x_;
   switch (this->model_) {
     case SSD1306_MODEL_64_48:
     case SSD1306_MODEL_64_32:
-      this->command(0x20 + this->offset_x_);
-      this->command(0x20 + this->offset_x_ + this->get_width_internal() - 1);
+      column_offset += 0x20;
       break;
     case SSD1306_MODEL_72_40:
-      this->command(0x1C + this->offset_x_);
-      this->command(0x1C + this->offset_x_ + this->get_width_internal() - 1);
+      column_offset += 0x1C;
       break;
     default:
-      this->command(0 + this->offset_x_);  // Page start address, 0
-      this->command(this->get_width_internal() + this->offset_x_ - 1);
       break;
   }
 
-  this->command(SSD1306_COMMAND_PAGE_ADDRESS);
-  // Page start address, 0
-  this->command(0);
-  // Page end address:
-  this->command((this->get_height_internal() / 8) - 1);
-
-  this->write_display_data();
+  // only send the pages and columns that changed, in horizontal addressing mode the display wraps to the next page
+  // at the end of the column range
+  for (uint8_t i = 0; i < this->get_dirty_count_(); i++) {
+    const display::Rect &rect = this->get_dirty_rects_()[i];
+    const uint8_t first_page = rect.y / 8;
+    const uint8_t last_page = (rect.y2() - 1) / 8;
+
+    this->command(SSD1306_COMMAND_COLUMN_ADDRESS);
+    this->command(column_offset + rect.x);
+    this->command(column_offset + rect.x2() - 1);
+    this->command(SSD1306_COMMAND_PAGE_ADDRESS);
+    this->command(first_page);
+    this->command(last_page);
+
+    for (uint8_t page = first_page; page <= last_page; page++)
+      this->write_display_bytes(this->buffer_ + page * this->get_width_internal() + rect.x, rect.w);
+  }
+  this->clear_dirty_();
 }
 bool SSD1306::is_sh1106_() const {
   return this->model_ == SH1106_MODEL_96_16 || this->model_ == SH1106_MODEL_128_32 ||
@@ -322,16 +335,34 @@ void HOT SSD1306::draw_absolute_pixel_internal(int x, int y, Color color) {
 
   uint16_t pos = x + (y / 8) * this->get_width_internal();
   uint8_t subpos = y & 0x07;
+  uint8_t value = this->buffer_[pos];
   if (color.is_on()) {
-    this->buffer_[pos] |= (1 << subpos);
+    value |= (1 << subpos);
   } else {
-    this->buffer_[pos] &= ~(1 << subpos);
+    value &= ~(1 << subpos);
+  }
+  if (value != this->buffer_[pos]) {
+    this->buffer_[pos] = value;
+    this->mark_dirty_(x, y);
   }
 }
 void SSD1306::fill(Color color) {
   uint8_t fill = color.is_on() ? 0xFF : 0x00;
-  for (uint32_t i = 0; i < this->get_buffer_length_(); i++)
-    this->buffer_[i] = fill;
+  const int width = this->get_width_internal();
+  // only mark the columns of each page that actually change
+  for (int page = 0; page < this->get_height_internal() / 8; page++) {
+    uint8_t *row = this->buffer_ + page * width;
+    int first = 0;
+    while (first < width && row[first] == fill)
+      first++;
+    if (first == width)
+      continue;
+    int last = width - 1;
+    while (row[last] == fill)
+      last--;
+    memset(row + first, fill, last - first + 1);
+    this->mark_dirty_(first, page * 8, last, page * 8 + 7);
+  }
 }
 void SSD1306::init_reset_() {
   if (this->reset_pin_ != nullptr) {
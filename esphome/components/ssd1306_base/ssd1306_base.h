@@ -58,6 +58,8 @@ class SSD1306 : public display::DisplayBuffer {
  protected:
   virtual void command(uint8_t value) = 0;
   virtual void write_display_data() = 0;
+  /// Send \p length bytes of display RAM data, used for partial updates in horizontal addressing mode.
+  virtual void write_display_bytes(const uint8_t *data, size_t length) = 0;
   void init_reset_();
 
   bool is_sh1106_() const;
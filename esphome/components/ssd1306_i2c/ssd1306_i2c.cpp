@@ -73,6 +73,11 @@ void HOT I2CSSD1306::write_display_data() {
     }
   }
 }
+void I2CSSD1306::write_display_bytes(const uint8_t *data, size_t length) {
+  // same block size as write_display_data() to stay within the I2C buffer
+  for (size_t i = 0; i < length; i += 16)
+    this->write_bytes(0x40, data + i, std::min<size_t>(16, length - i));
+}
 
 }  // namespace ssd1306_i2c
 }  // namespace esphome
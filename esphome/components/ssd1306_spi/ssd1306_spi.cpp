@@ -60,6 +60,12 @@ void HOT SPISSD1306::write_display_data() {
     this->disable();
   }
 }
+void SPISSD1306::write_display_bytes(const uint8_t *data, size_t length) {
+  this->dc_pin_->digital_write(true);
+  this->enable();
+  this->write_array(data, length);
+  this->disable();
+}
 
 }  // namespace ssd1306_spi
 }  // namespace esphome
@@ -21,6 +21,7 @@ class SPISSD1306 : public ssd1306_base::SSD1306,
   void command(uint8_t value) override;
 
   void write_display_data() override;
+  void write_display_bytes(const uint8_t *data, size_t length) override;
 
   GPIOPin *dc_pin_;
 };
@@ -310,10 +310,18 @@ void VoiceAssistant::loop() {
       this->read_microphone_();
       size_t available = this->ring_buffer_->available();
       while (available >= SEND_BUFFER_SIZE) {
-        size_t read_bytes = this->ring_buffer_->read((void *) this->send_buffer_, SEND_BUFFER_SIZE, 0);
+        // Send straight out of the ring buffer unless the chunk wraps around its end
+        size_t read_bytes;
+        const uint8_t *chunk = this->ring_buffer_->peek(&read_bytes);
+        if (read_bytes >= SEND_BUFFER_SIZE) {
+          read_bytes = SEND_BUFFER_SIZE;
+        } else {
+          read_bytes = this->ring_buffer_->read((void *) this->send_buffer_, SEND_BUFFER_SIZE);
+          chunk = this->send_buffer_;
+        }
         if (this->audio_mode_ == AUDIO_MODE_API) {
           api::VoiceAssistantAudio msg;
-          msg.data.assign((char *) this->send_buffer_, read_bytes);
+          msg.data.assign((const char *) chunk, read_bytes);
           this->api_client_->send_voice_assistant_audio(msg);
         } else {
           if (!this->udp_socket_running_) {
@@ -322,9 +330,10 @@ void VoiceAssistant::loop() {
               break;
             }
           }
-          this->socket_->sendto(this->send_buffer_, read_bytes, 0, (struct sockaddr *) &this->dest_addr_,
-                                sizeof(this->dest_addr_));
+          this->socket_->sendto(chunk, read_bytes, 0, (struct sockaddr *) &this->dest_addr_, sizeof(this->dest_addr_));
         }
+        if (chunk != this->send_buffer_)
+          this->ring_buffer_->consume(read_bytes);
         available = this->ring_buffer_->available();
       }
 
@@ -2,8 +2,19 @@ import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome.components.light.types import AddressableLightEffect
 from esphome.components.light.effects import register_addressable_effect
+from esphome.components.light.streaming import (
+    CONF_STREAMING,
+    STREAMING_SCHEMA,
+    setup_streaming,
+    streaming_auto_load,
+)
 from esphome.const import CONF_NAME, CONF_PORT
 
+
+def AUTO_LOAD():
+    return streaming_auto_load("wled")
+
+
 wled_ns = cg.esphome_ns.namespace("wled")
 WLEDLightEffect = wled_ns.class_("WLEDLightEffect", AddressableLightEffect)
 
@@ -20,6 +31,7 @@ CONF_BLANK_ON_START = "blank_on_start"
         cv.Optional(CONF_PORT, default=21324): cv.port,
         cv.Optional(CONF_SYNC_GROUP_MASK, default=0): cv.int_range(min=0, max=255),
         cv.Optional(CONF_BLANK_ON_START, default=True): cv.boolean,
+        cv.Optional(CONF_STREAMING): STREAMING_SCHEMA,
     },
 )
 async def wled_light_effect_to_code(config, effect_id):
@@ -27,4 +39,5 @@ async def wled_light_effect_to_code(config, effect_id):
     cg.add(effect.set_port(config[CONF_PORT]))
     cg.add(effect.set_sync_group_mask(config[CONF_SYNC_GROUP_MASK]))
     cg.add(effect.set_blank_on_start(config[CONF_BLANK_ON_START]))
+    await setup_streaming(effect, config)
     return effect
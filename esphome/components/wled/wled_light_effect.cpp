@@ -38,6 +38,10 @@ void WLEDLightEffect::start() {
   } else {
     this->blank_at_ = UINT32_MAX;
   }
+
+  if (this->stream_ != nullptr) {
+    this->stream_->start(this->get_addressable_()->size());
+  }
 }
 
 void WLEDLightEffect::stop() {
@@ -47,13 +51,17 @@ void WLEDLightEffect::stop() {
     udp_->stop();
     udp_.reset();
   }
+  if (this->stream_ != nullptr) {
+    this->stream_->stop();
+  }
 }
 
 void WLEDLightEffect::blank_all_leds_(light::AddressableLight &it) {
-  for (int led = it.size(); led-- > 0;) {
-    it[led].set(Color::BLACK);
-  }
+  it.all() = Color::BLACK;
   it.schedule_show();
+  if (this->is_streaming_()) {
+    this->stream_->clear();
+  }
 }
 
 void WLEDLightEffect::apply(light::AddressableLight &it, const Color &current_color) {
@@ -86,6 +94,10 @@ void WLEDLightEffect::apply(light::AddressableLight &it, const Color &current_co
     blank_all_leds_(it);
     blank_at_ = millis() + DEFAULT_BLANK_TIME;
   }
+
+  if (this->is_streaming_()) {
+    this->stream_->apply(it);
+  }
 }
 
 bool WLEDLightEffect::parse_frame_(light::AddressableLight &it, const uint8_t *payload, uint16_t size) {
@@ -98,6 +110,7 @@ bool WLEDLightEffect::parse_frame_(light::AddressableLight &it, const uint8_t *p
 
   uint8_t protocol = payload[0];
   uint8_t timeout = payload[1];
+  this->partial_frame_ = false;
 
   payload += 2;
   size -= 2;
@@ -149,7 +162,11 @@ bool WLEDLightEffect::parse_frame_(light::AddressableLight &it, const uint8_t *p
     blank_at_ = millis() + DEFAULT_BLANK_TIME;
   }
 
-  it.schedule_show();
+  if (!this->is_streaming_()) {
+    it.schedule_show();
+  } else if (!this->partial_frame_) {
+    this->stream_->commit();
+  }
   return true;
 }
 
@@ -175,8 +192,10 @@ bool WLEDLightEffect::parse_notifier_frame_(light::AddressableLight &it, const u
   uint8_t b = esp_scale8(payload[3], bri);
   uint8_t w = esp_scale8(payload[8], bri);
 
-  for (auto &&led : it) {
-    led.set(Color(r, g, b, w));
+  if (this->is_streaming_()) {
+    light::color_span_fill(this->stream_->frame(), it.size(), Color(r, g, b, w));
+  } else {
+    it.all() = Color(r, g, b, w);
   }
 
   return true;
@@ -198,7 +217,7 @@ bool WLEDLightEffect::parse_warls_frame_(light::AddressableLight &it, const uint
     uint8_t b = payload[3];
 
     if (led < max_leds) {
-      it[led].set(Color(r, g, b));
+      this->set_led_(it, led, Color(r, g, b));
     }
   }
 
@@ -220,7 +239,7 @@ bool WLEDLightEffect::parse_drgb_frame_(light::AddressableLight &it, const uint8
     uint8_t b = payload[2];
 
     if (led < max_leds) {
-      it[led].set(Color(r, g, b));
+      this->set_led_(it, led, Color(r, g, b));
     }
   }
 
@@ -243,7 +262,7 @@ bool WLEDLightEffect::parse_drgbw_frame_(light::AddressableLight &it, const uint
     uint8_t w = payload[3];
 
     if (led < max_leds) {
-      it[led].set(Color(r, g, b, w));
+      this->set_led_(it, led, Color(r, g, b, w));
     }
   }
 
@@ -274,9 +293,10 @@ bool WLEDLightEffect::parse_dnrgb_frame_(light::AddressableLight &it, const uint
     uint8_t b = payload[2];
 
     if (led < max_leds) {
-      it[led].set(Color(r, g, b));
+      this->set_led_(it, led, Color(r, g, b));
     }
   }
+  this->partial_frame_ = led < max_leds;
 
   return true;
 }
@@ -4,6 +4,7 @@
 
 #include "esphome/core/component.h"
 #include "esphome/components/light/addressable_light_effect.h"
+#include "esphome/components/light/addressable_light_stream.h"
 
 #include <vector>
 #include <memory>
@@ -23,9 +24,19 @@ class WLEDLightEffect : public light::AddressableLightEffect {
   void set_port(uint16_t port) { this->port_ = port; }
   void set_sync_group_mask(uint8_t mask) { this->sync_group_mask_ = mask; }
   void set_blank_on_start(bool blank) { this->blank_on_start_ = blank; }
+  void set_stream(light::AddressableLightStream *stream) { this->stream_ = stream; }
 
  protected:
   void blank_all_leds_(light::AddressableLight &it);
+  bool is_streaming_() const { return this->stream_ != nullptr && this->stream_->is_started(); }
+  /// Set an LED directly, or in the frame being received when streaming.
+  void set_led_(light::AddressableLight &it, int32_t led, const Color &color) {
+    if (this->is_streaming_()) {
+      this->stream_->frame()[led] = color;
+    } else {
+      it[led] = color;
+    }
+  }
   bool parse_frame_(light::AddressableLight &it, const uint8_t *payload, uint16_t size);
   bool parse_notifier_frame_(light::AddressableLight &it, const uint8_t *payload, uint16_t size);
   bool parse_warls_frame_(light::AddressableLight &it, const uint8_t *payload, uint16_t size);
@@ -33,12 +44,15 @@ class WLEDLightEffect : public light::AddressableLightEffect {
   bool parse_drgbw_frame_(light::AddressableLight &it, const uint8_t *payload, uint16_t size);
   bool parse_dnrgb_frame_(light::AddressableLight &it, const uint8_t *payload, uint16_t size);
 
+  light::AddressableLightStream *stream_{nullptr};
   uint16_t port_{0};
   std::unique_ptr<UDP> udp_;
   uint32_t blank_at_{0};
   uint32_t dropped_{0};
   uint8_t sync_group_mask_{0};
   bool blank_on_start_{true};
+  /// Set by DNRGB packets that don't reach the end of the strip, the frame continues in the next packet.
+  bool partial_frame_{false};
 };
 
 }  // namespace wled
@@ -7,10 +7,19 @@
 #include "esphome/components/status_led/status_led.h"
 #endif
 
+#ifdef USE_HOST
+#include <fcntl.h>
+#include <sys/select.h>
+#include <unistd.h>
+#endif
+
 namespace esphome {
 
 static const char *const TAG = "app";
 
+/// Upper bound for sleeping while no component needs loop(), so that the watchdog keeps being fed.
+static const uint32_t MAX_IDLE_SLEEP_MS = 1000;
+
 void Application::register_component_(Component *comp) {
   if (comp == nullptr) {
     ESP_LOGW(TAG, "Tried to register null component!");
@@ -27,6 +36,18 @@ void Application::register_component_(Component *comp) {
 }
 void Application::setup() {
   ESP_LOGI(TAG, "Running through setup()...");
+#ifdef USE_ESP32
+  this->loop_task_handle_ = xTaskGetCurrentTaskHandle();
+#endif
+#ifdef USE_HOST
+  if (::pipe(this->wake_pipe_) == 0) {
+    ::fcntl(this->wake_pipe_[0], F_SETFL, O_NONBLOCK);
+    ::fcntl(this->wake_pipe_[1], F_SETFL, O_NONBLOCK);
+  } else {
+    ESP_LOGW(TAG, "Could not create wake pipe: errno %d", errno);
+    this->wake_pipe_[0] = this->wake_pipe_[1] = -1;
+  }
+#endif
   ESP_LOGV(TAG, "Sorting components by setup priority...");
   std::stable_sort(this->components_.begin(), this->components_.end(), [](const Component *a, const Component *b) {
     return a->get_actual_setup_priority() > b->get_actual_setup_priority();
@@ -35,7 +56,13 @@ void Application::setup() {
   for (uint32_t i = 0; i < this->components_.size(); i++) {
     Component *component = this->components_[i];
 
+#ifdef USE_PROFILER
+    const uint32_t setup_start = micros();
+    component->call();
+    this->profiler.record(ProfilerKind::SETUP, component, 0, micros() - setup_start);
+#else
     component->call();
+#endif
     this->scheduler.process_to_add();
     this->feed_wdt();
     if (component->can_proceed())
@@ -65,24 +92,50 @@ void Application::setup() {
 }
 void Application::loop() {
   uint32_t new_app_state = 0;
+  const uint32_t loop_start = millis();
 
   this->scheduler.call();
   this->feed_wdt();
+  if (this->has_pending_enable_loop_requests_) {
+    this->has_pending_enable_loop_requests_ = false;
+    for (Component *component : this->looping_components_) {
+      if (component->pending_enable_loop_) {
+        component->pending_enable_loop_ = false;
+        component->enable_loop();
+      }
+    }
+  }
   for (Component *component : this->looping_components_) {
-    {
-      WarnIfComponentBlockingGuard guard{component};
-      component->call();
+    if (component->is_loop_enabled()) {
+      {
+        WarnIfComponentBlockingGuard guard{component};
+#ifdef USE_PROFILER
+        const uint32_t component_start = micros();
+        component->call();
+        this->profiler.record(ProfilerKind::LOOP, component, 0, micros() - component_start);
+#else
+        component->call();
+#endif
+      }
+      this->feed_wdt();
     }
     new_app_state |= component->get_component_state();
     this->app_state_ |= new_app_state;
-    this->feed_wdt();
   }
   this->app_state_ = new_app_state;
 
   const uint32_t now = millis();
+  this->max_loop_time_ = std::max(this->max_loop_time_, now - loop_start);
 
   auto elapsed = now - this->last_loop_;
-  if (elapsed >= this->loop_interval_ || HighFrequencyLoopRequester::is_high_frequency()) {
+  if (HighFrequencyLoopRequester::is_high_frequency() || this->dump_config_at_ < this->components_.size()) {
+    yield();
+  } else if (std::none_of(this->looping_components_.begin(), this->looping_components_.end(),
+                          [](Component *component) { return component->is_loop_enabled(); })) {
+    // Nothing needs polling: sleep until the next scheduled item or until something wakes us up.
+    uint32_t delay_time = this->scheduler.next_schedule_in().value_or(MAX_IDLE_SLEEP_MS);
+    this->sleep_until_woken_(std::min(delay_time, MAX_IDLE_SLEEP_MS));
+  } else if (elapsed >= this->loop_interval_) {
     yield();
   } else {
     uint32_t delay_time = this->loop_interval_ - elapsed;
@@ -91,7 +144,7 @@ void Application::loop() {
     // otherwise interval=0 schedules result in constant looping with almost no sleep
     next_schedule = std::max(next_schedule, delay_time / 2);
     delay_time = std::min(next_schedule, delay_time);
-    delay(delay_time);
+    this->sleep_until_woken_(delay_time);
   }
   this->last_loop_ = now;
 
@@ -143,6 +196,82 @@ void Application::run_safe_shutdown_hooks() {
   }
 }
 
+void IRAM_ATTR Application::wake_loop_threadsafe() {
+#ifdef USE_ESP32
+  if (this->loop_task_handle_ == nullptr)
+    return;
+  if (xPortInIsrContext()) {
+    BaseType_t higher_priority_task_woken = pdFALSE;
+    vTaskNotifyGiveFromISR(this->loop_task_handle_, &higher_priority_task_woken);
+    portYIELD_FROM_ISR(higher_priority_task_woken);
+  } else {
+    xTaskNotifyGive(this->loop_task_handle_);
+  }
+#elif defined(USE_HOST)
+  if (this->wake_pipe_[1] != -1) {
+    const uint8_t dummy = 0;
+    // a full pipe already guarantees a wakeup, so a failed write can be ignored
+    (void) ::write(this->wake_pipe_[1], &dummy, 1);
+  }
+#endif
+}
+
+void Application::sleep_until_woken_(uint32_t delay_ms) {
+#ifdef USE_ESP32
+  if (this->loop_task_handle_ != nullptr) {
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(delay_ms));
+    return;
+  }
+  delay(delay_ms);
+#elif defined(USE_HOST)
+  if (this->wake_pipe_[0] == -1) {
+    delay(delay_ms);
+    return;
+  }
+  fd_set read_fds;
+  FD_ZERO(&read_fds);
+  FD_SET(this->wake_pipe_[0], &read_fds);
+  int max_fd = this->wake_pipe_[0];
+  for (auto &watched : this->watched_sockets_) {
+    FD_SET(watched.fd, &read_fds);
+    max_fd = std::max(max_fd, watched.fd);
+  }
+  struct timeval tv;
+  tv.tv_sec = delay_ms / 1000;
+  tv.tv_usec = (delay_ms % 1000) * 1000;
+  int ret = ::select(max_fd + 1, &read_fds, nullptr, nullptr, &tv);
+  if (ret <= 0)
+    return;
+  if (FD_ISSET(this->wake_pipe_[0], &read_fds)) {
+    uint8_t buf[16];
+    while (::read(this->wake_pipe_[0], buf, sizeof(buf)) > 0) {
+    }
+  }
+  for (auto &watched : this->watched_sockets_) {
+    if (FD_ISSET(watched.fd, &read_fds) && watched.component != nullptr)
+      watched.component->enable_loop();
+  }
+#else
+  delay(delay_ms);
+#endif
+}
+
+#ifdef USE_HOST
+void Application::register_socket_fd(int fd, Component *component) {
+  if (fd < 0 || fd >= FD_SETSIZE) {
+    ESP_LOGW(TAG, "Cannot watch socket fd %d", fd);
+    return;
+  }
+  this->unregister_socket_fd(fd);
+  this->watched_sockets_.push_back(WatchedSocket{fd, component});
+}
+void Application::unregister_socket_fd(int fd) {
+  this->watched_sockets_.erase(std::remove_if(this->watched_sockets_.begin(), this->watched_sockets_.end(),
+                                              [fd](const WatchedSocket &watched) { return watched.fd == fd; }),
+                               this->watched_sockets_.end());
+}
+#endif
+
 void Application::calculate_looping_components_() {
   for (auto *obj : this->components_) {
     if (obj->has_overridden_loop())
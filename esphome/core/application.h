@@ -7,8 +7,14 @@
 #include "esphome/core/hal.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/preferences.h"
+#include "esphome/core/profiler.h"
 #include "esphome/core/scheduler.h"
 
+#ifdef USE_ESP32
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
 #ifdef USE_BINARY_SENSOR
 #include "esphome/components/binary_sensor/binary_sensor.h"
 #endif
@@ -231,8 +237,29 @@ class Application {
 
   uint32_t get_loop_interval() const { return this->loop_interval_; }
 
+  /// Longest time in milliseconds one loop iteration spent running components (not sleeping) since the last reset.
+  uint32_t get_max_loop_time() const { return this->max_loop_time_; }
+  void reset_max_loop_time() { this->max_loop_time_ = 0; }
+
   void schedule_dump_config() { this->dump_config_at_ = 0; }
 
+  /** Wake up the main loop if it is sleeping. Safe to call from ISRs and other tasks.
+   *
+   * Uses a task notification on ESP32 and a self-pipe on the host platform. On other platforms the loop isn't
+   * woken up early and will notice pending work within the next loop interval.
+   */
+  void wake_loop_threadsafe();
+
+#ifdef USE_HOST
+  /** Watch a socket file descriptor while the main loop sleeps.
+   *
+   * When \p fd becomes readable, the loop wakes up and re-enables the loop() of \p component if it was disabled
+   * with disable_loop().
+   */
+  void register_socket_fd(int fd, Component *component);
+  void unregister_socket_fd(int fd);
+#endif
+
   void feed_wdt();
 
   void reboot();
@@ -460,6 +487,9 @@ class Application {
 #endif
 
   Scheduler scheduler;
+#ifdef USE_PROFILER
+  Profiler profiler;
+#endif
 
  protected:
   friend Component;
@@ -468,6 +498,9 @@ class Application {
 
   void calculate_looping_components_();
 
+  /// Sleep for up to \p delay_ms, returning early when woken by wake_loop_threadsafe() or a watched socket.
+  void sleep_until_woken_(uint32_t delay_ms);
+
   void feed_wdt_arch_();
 
   std::vector<Component *> components_{};
@@ -545,8 +578,22 @@ class Application {
   bool name_add_mac_suffix_;
   uint32_t last_loop_{0};
   uint32_t loop_interval_{16};
+  uint32_t max_loop_time_{0};
   size_t dump_config_at_{SIZE_MAX};
   uint32_t app_state_{0};
+  /// Set when a component called enable_loop_soon_any_context().
+  volatile bool has_pending_enable_loop_requests_{false};
+#ifdef USE_ESP32
+  TaskHandle_t loop_task_handle_{nullptr};
+#endif
+#ifdef USE_HOST
+  struct WatchedSocket {
+    int fd;
+    Component *component;
+  };
+  std::vector<WatchedSocket> watched_sockets_{};
+  int wake_pipe_[2]{-1, -1};
+#endif
 };
 
 /// Global storage of Application pointer - only one Application can exist.
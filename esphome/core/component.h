@@ -5,6 +5,7 @@
 #include <functional>
 #include <string>
 
+#include "esphome/core/delegate.h"
 #include "esphome/core/optional.h"
 
 namespace esphome {
@@ -58,6 +59,7 @@ extern const uint32_t COMPONENT_STATE_CONSTRUCTION;
 extern const uint32_t COMPONENT_STATE_SETUP;
 extern const uint32_t COMPONENT_STATE_LOOP;
 extern const uint32_t COMPONENT_STATE_FAILED;
+extern const uint32_t COMPONENT_STATE_LOOP_DONE;
 extern const uint32_t STATUS_LED_MASK;
 extern const uint32_t STATUS_LED_OK;
 extern const uint32_t STATUS_LED_WARNING;
@@ -142,6 +144,25 @@ class Component {
 
   bool has_overridden_loop() const;
 
+  /** Stop calling loop() for this component until enable_loop() is called.
+   *
+   * Meant for components that only have work to do when an event arrives (data on a socket, an entry in a queue, a
+   * flag set from an ISR). When no component needs loop() anymore, the main loop sleeps until the next scheduled
+   * timeout/interval or until it is woken up with App.wake_loop_threadsafe().
+   *
+   * Only has an effect once setup() is finished, i.e. call this from loop().
+   */
+  void disable_loop();
+
+  /// Resume calling loop() for this component after disable_loop(). Must be called from the main loop.
+  void enable_loop();
+
+  /// Same as enable_loop(), but safe to call from an ISR or another task. Takes effect on the next loop iteration.
+  void enable_loop_soon_any_context();
+
+  /// Whether loop() is called for this component, i.e. it finished setup, isn't failed and didn't disable its loop.
+  bool is_loop_enabled() const;
+
   /** Set where this component was loaded from for some debug messages.
    *
    * This is set by the ESPHome core, and should not be called manually.
@@ -175,9 +196,11 @@ class Component {
    *
    * @see cancel_interval()
    */
-  void set_interval(const std::string &name, uint32_t interval, std::function<void()> &&f);  // NOLINT
+  void set_interval(const std::string &name, uint32_t interval, Delegate<void()> &&f);  // NOLINT
+  /// Overload for string literals, avoids constructing a std::string on every call.
+  void set_interval(const char *name, uint32_t interval, Delegate<void()> &&f);  // NOLINT
 
-  void set_interval(uint32_t interval, std::function<void()> &&f);  // NOLINT
+  void set_interval(uint32_t interval, Delegate<void()> &&f);  // NOLINT
 
   /** Cancel an interval function.
    *
@@ -185,6 +208,7 @@ class Component {
    * @return Whether an interval functions was deleted.
    */
   bool cancel_interval(const std::string &name);  // NOLINT
+  bool cancel_interval(const char *name);         // NOLINT
 
   /** Set an retry function with a unique name. Empty name means no cancelling possible.
    *
@@ -216,11 +240,11 @@ class Component {
    * @param backoff_increase_factor time between retries is multiplied by this factor on every retry after the first
    * @see cancel_retry()
    */
-  void set_retry(const std::string &name, uint32_t initial_wait_time, uint8_t max_attempts,       // NOLINT
-                 std::function<RetryResult(uint8_t)> &&f, float backoff_increase_factor = 1.0f);  // NOLINT
+  void set_retry(const std::string &name, uint32_t initial_wait_time, uint8_t max_attempts,  // NOLINT
+                 Delegate<RetryResult(uint8_t)> &&f, float backoff_increase_factor = 1.0f);  // NOLINT
 
-  void set_retry(uint32_t initial_wait_time, uint8_t max_attempts, std::function<RetryResult(uint8_t)> &&f,  // NOLINT
-                 float backoff_increase_factor = 1.0f);                                                      // NOLINT
+  void set_retry(uint32_t initial_wait_time, uint8_t max_attempts, Delegate<RetryResult(uint8_t)> &&f,  // NOLINT
+                 float backoff_increase_factor = 1.0f);                                                 // NOLINT
 
   /** Cancel a retry function.
    *
@@ -243,9 +267,11 @@ class Component {
    *
    * @see cancel_timeout()
    */
-  void set_timeout(const std::string &name, uint32_t timeout, std::function<void()> &&f);  // NOLINT
+  void set_timeout(const std::string &name, uint32_t timeout, Delegate<void()> &&f);  // NOLINT
+  /// Overload for string literals, avoids constructing a std::string on every call.
+  void set_timeout(const char *name, uint32_t timeout, Delegate<void()> &&f);  // NOLINT
 
-  void set_timeout(uint32_t timeout, std::function<void()> &&f);  // NOLINT
+  void set_timeout(uint32_t timeout, Delegate<void()> &&f);  // NOLINT
 
   /** Cancel a timeout function.
    *
@@ -253,6 +279,7 @@ class Component {
    * @return Whether a timeout functions was deleted.
    */
   bool cancel_timeout(const std::string &name);  // NOLINT
+  bool cancel_timeout(const char *name);         // NOLINT
 
   /** Defer a callback to the next loop() call.
    *
@@ -261,15 +288,17 @@ class Component {
    * @param name The name of the defer function.
    * @param f The callback.
    */
-  void defer(const std::string &name, std::function<void()> &&f);  // NOLINT
+  void defer(const std::string &name, Delegate<void()> &&f);  // NOLINT
 
   /// Defer a callback to the next loop() call.
-  void defer(std::function<void()> &&f);  // NOLINT
+  void defer(Delegate<void()> &&f);  // NOLINT
 
   /// Cancel a defer callback using the specified name, name must not be empty.
   bool cancel_defer(const std::string &name);  // NOLINT
 
   uint32_t component_state_{0x0000};  ///< State of this component.
+  /// Set by enable_loop_soon_any_context(), picked up by the main loop.
+  volatile bool pending_enable_loop_{false};
   float setup_priority_override_{NAN};
   const char *component_source_{nullptr};
 };
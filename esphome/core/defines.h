@@ -61,6 +61,7 @@
 #define USE_OTA_VERSION 1
 #define USE_OUTPUT
 #define USE_POWER_SUPPLY
+#define USE_PROFILER
 #define USE_QR_CODE
 #define USE_SELECT
 #define USE_SENSOR
@@ -99,6 +100,8 @@
 #define USE_ESP32_BLE_SERVER
 #define USE_ESP32_CAMERA
 #define USE_IMPROV
+#define USE_LOGGER_BINARY
+#define USE_LOGGER_TASK_LOG_BUFFER
 #define USE_MICRO_WAKE_WORD_VAD
 #define USE_MICROPHONE
 #define USE_PSRAM
@@ -156,6 +159,7 @@
 #endif
 
 #ifdef USE_HOST
+#define USE_LOGGER_TASK_LOG_BUFFER
 #define USE_SOCKET_IMPL_BSD_SOCKETS
 #endif
 
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace esphome {
+
+template<typename> class Delegate;
+
+namespace delegate_detail {
+
+/// Whether the callable is empty, so that wrapping an empty std::function or a null pointer gives an empty delegate.
+template<typename F> bool is_null(const F & /*f*/) { return false; }
+template<typename F> bool is_null(F *f) { return f == nullptr; }
+template<typename Sig> bool is_null(const std::function<Sig> &f) { return !f; }
+template<typename Sig> bool is_null(const Delegate<Sig> &f) { return !f; }
+
+}  // namespace delegate_detail
+
+/** Type-erased callable like std::function, with room for the captures of typical lambdas inline.
+ *
+ * Callables of up to INLINE_SIZE bytes (a lambda capturing four pointers, or a std::function) are stored in the
+ * delegate itself and never allocate. Larger callables fall back to the heap, like std::function. The operations on
+ * the stored callable live in one constant table per callable type, so a delegate is its storage plus one pointer.
+ *
+ * Unlike std::function, calling an empty delegate is undefined.
+ *
+ * @tparam R The return type.
+ * @tparam Ts The arguments.
+ */
+template<typename R, typename... Ts> class Delegate<R(Ts...)> {
+ public:
+  static constexpr size_t INLINE_SIZE = 4 * sizeof(void *);
+
+  Delegate() = default;
+  Delegate(std::nullptr_t) {}  // NOLINT(google-explicit-constructor)
+  template<typename F, typename D = typename std::decay<F>::type,
+           typename = typename std::enable_if<!std::is_same<D, Delegate>::value>::type,
+           typename = decltype(std::declval<D &>()(std::declval<Ts>()...))>
+  Delegate(F &&f) {  // NOLINT(google-explicit-constructor)
+    if (delegate_detail::is_null(f))
+      return;
+    using M = Model<D, fits_inline<D>()>;
+    M::create(this->storage_, std::forward<F>(f));
+    this->ops_ = M::ops();
+  }
+
+  Delegate(const Delegate &other) : ops_(other.ops_) {
+    if (this->ops_ != nullptr)
+      this->ops_->copy(this->storage_, other.storage_);
+  }
+  Delegate(Delegate &&other) noexcept : ops_(other.ops_) {
+    if (this->ops_ != nullptr) {
+      this->ops_->move(this->storage_, other.storage_);
+      other.ops_ = nullptr;
+    }
+  }
+  ~Delegate() { this->reset_(); }
+
+  Delegate &operator=(const Delegate &other) {
+    if (this != &other) {
+      this->reset_();
+      if (other.ops_ != nullptr)
+        other.ops_->copy(this->storage_, other.storage_);
+      this->ops_ = other.ops_;
+    }
+    return *this;
+  }
+  Delegate &operator=(Delegate &&other) noexcept {
+    if (this != &other) {
+      this->reset_();
+      if (other.ops_ != nullptr)
+        other.ops_->move(this->storage_, other.storage_);
+      this->ops_ = other.ops_;
+      other.ops_ = nullptr;
+    }
+    return *this;
+  }
+  Delegate &operator=(std::nullptr_t) {
+    this->reset_();
+    return *this;
+  }
+
+  R operator()(Ts... args) const { return this->ops_->invoke(this->storage_, std::forward<Ts>(args)...); }
+
+  explicit operator bool() const { return this->ops_ != nullptr; }
+  bool operator==(std::nullptr_t) const { return this->ops_ == nullptr; }
+  bool operator!=(std::nullptr_t) const { return this->ops_ != nullptr; }
+
+ protected:
+  struct Ops {
+    R (*invoke)(void *storage, Ts &&...args);
+    void (*copy)(void *dst, const void *src);
+    void (*move)(void *dst, void *src);
+    void (*destroy)(void *storage);
+  };
+
+  template<typename F> static constexpr bool fits_inline() {
+    return sizeof(F) <= INLINE_SIZE && alignof(F) <= alignof(void *) && std::is_nothrow_move_constructible<F>::value;
+  }
+
+  template<typename F, bool Inline> struct Model;
+  /// The callable itself is in the storage.
+  template<typename F> struct Model<F, true> {
+    static F *get(void *storage) { return static_cast<F *>(storage); }
+    template<typename A> static void create(void *storage, A &&f) { new (storage) F(std::forward<A>(f)); }
+    static R invoke(void *storage, Ts &&...args) { return static_cast<R>((*get(storage))(std::forward<Ts>(args)...)); }
+    static void copy(void *dst, const void *src) { new (dst) F(*static_cast<const F *>(src)); }
+    static void move(void *dst, void *src) {
+      new (dst) F(std::move(*get(src)));
+      get(src)->~F();
+    }
+    static void destroy(void *storage) { get(storage)->~F(); }
+    static const Ops *ops() {
+      static const Ops OPS = {&invoke, &copy, &move, &destroy};
+      return &OPS;
+    }
+  };
+  /// The storage holds a pointer to the callable on the heap.
+  template<typename F> struct Model<F, false> {
+    static F *&get(void *storage) { return *static_cast<F **>(storage); }
+    template<typename A> static void create(void *storage, A &&f) {
+      new (storage) F *(new F(std::forward<A>(f)));  // NOLINT(cppcoreguidelines-owning-memory)
+    }
+    static R invoke(void *storage, Ts &&...args) { return static_cast<R>((*get(storage))(std::forward<Ts>(args)...)); }
+    static void copy(void *dst, const void *src) {
+      new (dst) F *(new F(**static_cast<F *const *>(src)));  // NOLINT(cppcoreguidelines-owning-memory)
+    }
+    static void move(void *dst, void *src) { new (dst) F *(get(src)); }
+    static void destroy(void *storage) { delete get(storage); }  // NOLINT(cppcoreguidelines-owning-memory)
+    static const Ops *ops() {
+      static const Ops OPS = {&invoke, &copy, &move, &destroy};
+      return &OPS;
+    }
+  };
+
+  void reset_() {
+    if (this->ops_ != nullptr) {
+      this->ops_->destroy(this->storage_);
+      this->ops_ = nullptr;
+    }
+  }
+
+  alignas(void *) mutable uint8_t storage_[INLINE_SIZE];
+  const Ops *ops_{nullptr};
+};
+
+static_assert(sizeof(Delegate<void()>) == 5 * sizeof(void *), "Delegate must stay its inline storage plus a pointer");
+static_assert(sizeof(Delegate<void(float)>) == sizeof(Delegate<void(int, const char *, const char *)>),
+              "Delegates of all signatures must have the same size");
+
+}  // namespace esphome
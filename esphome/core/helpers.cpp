@@ -617,6 +617,28 @@ void hsv_to_rgb(int hue, float saturation, float value, float &red, float &green
   blue += delta;
 }
 
+// Utilities
+
+// CallbackManager nodes are carved from blocks of this many and recycled through a free list, so a callback costs no
+// heap allocation of its own. Callbacks are almost always added once during setup and never removed.
+static const size_t CALLBACK_NODES_PER_BLOCK = 8;
+static void *callback_free_nodes = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+void *callback_node_allocate() {
+  if (callback_free_nodes == nullptr) {
+    auto *block = static_cast<uint8_t *>(::operator new(CALLBACK_NODE_SIZE * CALLBACK_NODES_PER_BLOCK));
+    for (size_t i = 0; i < CALLBACK_NODES_PER_BLOCK; i++)
+      callback_node_free(block + i * CALLBACK_NODE_SIZE);
+  }
+  void *node = callback_free_nodes;
+  callback_free_nodes = *static_cast<void **>(node);
+  return node;
+}
+void callback_node_free(void *node) {
+  *static_cast<void **>(node) = callback_free_nodes;
+  callback_free_nodes = node;
+}
+
 // System APIs
 #if defined(USE_ESP8266) || defined(USE_RP2040) || defined(USE_HOST)
 // ESP8266 doesn't have mutexes, but that shouldn't be an issue as it's single-core and non-preemptive OS.
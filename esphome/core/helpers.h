@@ -8,6 +8,7 @@
 #include <type_traits>
 #include <vector>
 
+#include "esphome/core/delegate.h"
 #include "esphome/core/optional.h"
 
 #ifdef USE_ESP32
@@ -165,6 +166,15 @@ uint16_t crc16be(const uint8_t *data, uint16_t len, uint16_t crc = 0, uint16_t p
 
 /// Calculate a FNV-1 hash of \p str.
 uint32_t fnv1_hash(const std::string &str);
+/// Calculate a FNV-1 hash of the null-terminated string \p str. Folded to a constant for string literals.
+constexpr14 uint32_t fnv1_hash(const char *str) {
+  uint32_t hash = 2166136261UL;
+  for (; *str != '\0'; str++) {
+    hash *= 16777619UL;
+    hash ^= *str;
+  }
+  return hash;
+}
 
 /// Return a random 32-bit unsigned integer.
 uint32_t random_uint32();
@@ -471,29 +481,79 @@ constexpr float fahrenheit_to_celsius(float value) { return (value - 32.0f) / 1.
 /// @name Utilities
 /// @{
 
+/// Size of a node in the list of a CallbackManager, the same for all signatures.
+static constexpr size_t CALLBACK_NODE_SIZE = sizeof(void *) + sizeof(Delegate<void()>);
+/// Allocate memory for a CallbackManager node from a pool of fixed-size nodes. Not thread safe.
+void *callback_node_allocate();
+/// Return a node allocated with callback_node_allocate() to the pool.
+void callback_node_free(void *node);
+
 template<typename... X> class CallbackManager;
 
 /** Helper class to allow having multiple subscribers to a callback.
+ *
+ * The callbacks are kept in a singly linked list of nodes from a shared pool, so an empty manager is a single pointer
+ * and adding a callback doesn't reallocate the others.
  *
  * @tparam Ts The arguments for the callbacks, wrapped in void().
  */
 template<typename... Ts> class CallbackManager<void(Ts...)> {
  public:
+  CallbackManager() = default;
+  CallbackManager(const CallbackManager &other) { this->copy_from_(other); }
+  CallbackManager &operator=(const CallbackManager &other) {
+    if (this != &other) {
+      this->clear_();
+      this->copy_from_(other);
+    }
+    return *this;
+  }
+  ~CallbackManager() { this->clear_(); }
+
   /// Add a callback to the list.
-  void add(std::function<void(Ts...)> &&callback) { this->callbacks_.push_back(std::move(callback)); }
+  void add(Delegate<void(Ts...)> &&callback) {
+    Node **next = &this->first_;
+    while (*next != nullptr)
+      next = &(*next)->next;
+    *next = new (callback_node_allocate()) Node{nullptr, std::move(callback)};
+  }
 
   /// Call all callbacks in this manager.
   void call(Ts... args) {
-    for (auto &cb : this->callbacks_)
-      cb(args...);
+    for (Node *node = this->first_; node != nullptr; node = node->next)
+      node->callback(args...);
+  }
+  size_t size() const {
+    size_t size = 0;
+    for (Node *node = this->first_; node != nullptr; node = node->next)
+      size++;
+    return size;
   }
-  size_t size() const { return this->callbacks_.size(); }
 
   /// Call all callbacks in this manager.
   void operator()(Ts... args) { call(args...); }
 
  protected:
-  std::vector<std::function<void(Ts...)>> callbacks_;
+  struct Node {
+    Node *next;
+    Delegate<void(Ts...)> callback;
+  };
+  static_assert(sizeof(Node) == CALLBACK_NODE_SIZE, "CallbackManager nodes must fit the shared pool");
+
+  void copy_from_(const CallbackManager &other) {
+    for (Node *node = other.first_; node != nullptr; node = node->next)
+      this->add(Delegate<void(Ts...)>(node->callback));
+  }
+  void clear_() {
+    while (this->first_ != nullptr) {
+      Node *node = this->first_;
+      this->first_ = node->next;
+      node->~Node();
+      callback_node_free(node);
+    }
+  }
+
+  Node *first_{nullptr};
 };
 
 /// Helper class to deduplicate items in a series of values.
@@ -0,0 +1,268 @@
+#include "esphome/core/preference_store.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+#include <cinttypes>
+#include <cstddef>
+#include <cstring>
+
+namespace esphome {
+
+static const char *const TAG = "preferences";
+
+static const uint32_t CHUNK_MAGIC = 0x53504845;  // "EHPS"
+
+/// A page starts with a chunk holding all preferences, followed by chunks with the ones changed since.
+struct ChunkHeader {
+  uint32_t magic;
+  uint32_t sequence;
+  /// Bytes of records following the header.
+  uint32_t length;
+  uint16_t count;
+  /// CRC of the fields above.
+  uint16_t crc;
+};
+
+struct RecordHeader {
+  uint32_t key;
+  uint16_t length;
+  /// CRC of the key and the data.
+  uint16_t crc;
+};
+
+static uint16_t record_crc(uint32_t key, const uint8_t *data, uint16_t length) {
+  uint16_t crc = crc16(reinterpret_cast<const uint8_t *>(&key), sizeof(key));
+  return crc16(data, length, crc);
+}
+
+/** Check the header and all records of the chunk at \p position.
+ *
+ * Returns the position following the chunk, or 0 if it is damaged (an interrupted write) or there is no chunk.
+ */
+static size_t validate_chunk(const std::vector<uint8_t> &data, size_t position, ChunkHeader &header) {
+  if (data.size() - position < sizeof(ChunkHeader))
+    return 0;
+  memcpy(&header, &data[position], sizeof(ChunkHeader));
+  if (header.magic != CHUNK_MAGIC || header.crc != crc16(&data[position], offsetof(ChunkHeader, crc)) ||
+      header.length > data.size() - position - sizeof(ChunkHeader))
+    return 0;
+  position += sizeof(ChunkHeader);
+  const size_t end = position + header.length;
+  for (uint16_t i = 0; i < header.count; i++) {
+    RecordHeader record;
+    if (end - position < sizeof(RecordHeader))
+      return 0;
+    memcpy(&record, &data[position], sizeof(RecordHeader));
+    position += sizeof(RecordHeader);
+    if (end - position < record.length || record.crc != record_crc(record.key, &data[position], record.length))
+      return 0;
+    position += record.length;
+  }
+  return position == end ? end : 0;
+}
+
+/// Length of the valid chunks at the start of \p data, each one following the sequence of the previous one.
+static size_t validate_page(const std::vector<uint8_t> &data, uint32_t &sequence) {
+  ChunkHeader header;
+  size_t length = validate_chunk(data, 0, header);
+  if (length == 0)
+    return 0;
+  sequence = header.sequence;
+  while (size_t end = validate_chunk(data, length, header)) {
+    if (header.sequence != sequence + 1)
+      break;
+    sequence = header.sequence;
+    length = end;
+  }
+  return length;
+}
+
+void PreferenceStore::open() {
+  std::vector<uint8_t> data;
+  std::vector<uint8_t> newest;
+  uint32_t newest_sequence = 0;
+  size_t newest_length = 0;
+  int newest_page = -1;
+  for (uint8_t page = 0; page < this->page_count_; page++) {
+    if (!this->pages_->read_page(page, data))
+      continue;
+    uint32_t sequence;
+    const size_t length = validate_page(data, sequence);
+    if (length == 0)
+      continue;
+    if (newest_page < 0 || int32_t(sequence - newest_sequence) > 0) {
+      newest_page = page;
+      newest_sequence = sequence;
+      newest_length = length;
+      newest.swap(data);
+    }
+  }
+  if (newest_page < 0) {
+    ESP_LOGD(TAG, "No stored preferences found");
+    return;
+  }
+
+  // later chunks overwrite the preferences of earlier ones
+  uint16_t chunks = 0;
+  size_t position = 0;
+  while (position < newest_length) {
+    ChunkHeader header;
+    memcpy(&header, &newest[position], sizeof(ChunkHeader));
+    position += sizeof(ChunkHeader);
+    for (uint16_t i = 0; i < header.count; i++) {
+      RecordHeader record;
+      memcpy(&record, &newest[position], sizeof(RecordHeader));
+      position += sizeof(RecordHeader);
+      int slot = this->add(record.key, record.length);
+      if (slot >= 0) {
+        memcpy(&this->image_[this->slots_[slot].offset], &newest[position], record.length);
+        this->slots_[slot].valid = true;
+      }
+      position += record.length;
+    }
+    chunks++;
+  }
+  this->loaded_ = true;
+  this->sequence_ = newest_sequence;
+  this->page_ = newest_page;
+  this->page_used_ = newest_length;
+  // chunks appended after a damaged one couldn't be read, start a new page instead
+  this->append_ = newest_length == newest.size();
+  ESP_LOGD(TAG, "Loaded %zu preferences from %u chunks of page %d (sequence %" PRIu32 ")", this->slots_.size(),
+           chunks, newest_page, newest_sequence);
+}
+
+int PreferenceStore::add(uint32_t key, size_t length) {
+  if (length > UINT16_MAX)
+    return -1;
+  for (size_t i = 0; i < this->slots_.size(); i++) {
+    auto &slot = this->slots_[i];
+    if (slot.key != key)
+      continue;
+    if (slot.length != length) {
+      // the data type changed, the stored value can't be used anymore
+      if (this->image_.size() + length > UINT16_MAX)
+        return -1;
+      slot.offset = this->image_.size();
+      slot.length = length;
+      slot.valid = false;
+      this->image_.resize(this->image_.size() + length);
+    }
+    return i;
+  }
+  if (this->image_.size() + length > UINT16_MAX)
+    return -1;
+  Slot slot{};
+  slot.key = key;
+  slot.offset = this->image_.size();
+  slot.length = length;
+  this->slots_.push_back(slot);
+  this->image_.resize(this->image_.size() + length);
+  return this->slots_.size() - 1;
+}
+
+bool PreferenceStore::save(int slot, const uint8_t *data, size_t len) {
+  auto &s = this->slots_[slot];
+  if (s.length != len)
+    return false;
+  uint8_t *stored = &this->image_[s.offset];
+  if (s.valid && memcmp(stored, data, len) == 0)
+    return true;
+  memcpy(stored, data, len);
+  s.valid = true;
+  s.dirty = true;
+  this->dirty_ = true;
+  return true;
+}
+
+bool PreferenceStore::load(int slot, uint8_t *data, size_t len) const {
+  const auto &s = this->slots_[slot];
+  if (!s.valid || s.length != len)
+    return false;
+  memcpy(data, &this->image_[s.offset], len);
+  return true;
+}
+
+uint16_t PreferenceStore::encode_chunk_(std::vector<uint8_t> &data, bool dirty_only) const {
+  const size_t start = data.size();
+  data.resize(start + sizeof(ChunkHeader));
+  ChunkHeader header{};
+  header.magic = CHUNK_MAGIC;
+  header.sequence = this->sequence_ + 1;
+  for (const auto &slot : this->slots_) {
+    if (!slot.valid || (dirty_only && !slot.dirty))
+      continue;
+    const uint8_t *value = &this->image_[slot.offset];
+    RecordHeader record{slot.key, slot.length, record_crc(slot.key, value, slot.length)};
+    const auto *record_bytes = reinterpret_cast<const uint8_t *>(&record);
+    data.insert(data.end(), record_bytes, record_bytes + sizeof(RecordHeader));
+    data.insert(data.end(), value, value + slot.length);
+    header.count++;
+  }
+  header.length = data.size() - start - sizeof(ChunkHeader);
+  header.crc = crc16(reinterpret_cast<const uint8_t *>(&header), offsetof(ChunkHeader, crc));
+  memcpy(&data[start], &header, sizeof(ChunkHeader));
+  return header.count;
+}
+
+bool PreferenceStore::sync() {
+  this->stats_.syncs++;
+  if (!this->dirty_ || this->erased_)
+    return true;
+
+  std::vector<uint8_t> chunk;
+  const uint16_t changed = this->encode_chunk_(chunk, true);
+  const bool new_page = !this->append_ || this->page_used_ + chunk.size() > this->page_size_;
+  uint8_t page = this->page_;
+  uint16_t count = changed;
+  bool success;
+  if (new_page) {
+    // start the next page with all preferences, the current one stays valid until that succeeded
+    chunk.clear();
+    count = this->encode_chunk_(chunk, false);
+    if (this->page_used_ != 0)
+      page = (page + 1) % this->page_count_;
+    success = this->pages_->write_page(page, chunk.data(), chunk.size());
+  } else {
+    success = this->pages_->append_page(page, chunk.data(), chunk.size());
+  }
+  if (!success) {
+    this->stats_.failed_writes++;
+    // the page might end with a partial chunk now
+    this->append_ = false;
+    ESP_LOGE(TAG, "Writing %u preferences to page %u failed", count, page);
+    return false;
+  }
+
+  this->sequence_++;
+  this->page_ = page;
+  this->append_ = true;
+  if (new_page) {
+    this->page_used_ = chunk.size();
+    this->stats_.page_writes++;
+  } else {
+    this->page_used_ += chunk.size();
+    this->stats_.appends++;
+  }
+  for (auto &slot : this->slots_)
+    slot.dirty = false;
+  this->dirty_ = false;
+  this->stats_.slot_writes += changed;
+  this->stats_.bytes_written += chunk.size();
+  ESP_LOGD(TAG, "%s %u preferences (%u changed, %zu bytes) to page %u", new_page ? "Wrote" : "Appended", count,
+           changed, chunk.size(), page);
+  return true;
+}
+
+bool PreferenceStore::reset() {
+  for (auto &slot : this->slots_) {
+    slot.valid = false;
+    slot.dirty = false;
+  }
+  this->dirty_ = false;
+  // nothing is written anymore until the restart that usually follows
+  this->erased_ = true;
+  return this->pages_->erase();
+}
+
+}  // namespace esphome
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace esphome {
+
+/// Storage medium of a PreferenceStore: a few pages that are written as a whole and then appended to.
+class PreferenceStorePages {
+ public:
+  /// Read page \p page, including everything appended to it, into \p data. Returns false if the page doesn't exist.
+  virtual bool read_page(uint8_t page, std::vector<uint8_t> &data) = 0;
+  /// Replace the contents of page \p page.
+  virtual bool write_page(uint8_t page, const uint8_t *data, size_t len) = 0;
+  /// Add \p data to the end of page \p page.
+  virtual bool append_page(uint8_t page, const uint8_t *data, size_t len) = 0;
+  /// Erase all pages.
+  virtual bool erase() = 0;
+};
+
+struct PreferenceStoreStats {
+  /// Number of sync() calls.
+  uint32_t syncs;
+  /// Number of pages written with all preferences, when the current page is full.
+  uint32_t page_writes;
+  /// Number of times the changed preferences were appended to the current page.
+  uint32_t appends;
+  /// Number of changed preferences written out.
+  uint32_t slot_writes;
+  uint32_t bytes_written;
+  uint32_t failed_writes;
+};
+
+/** Write-coalescing preference store.
+ *
+ * All preferences live in one compact RAM image. Saving a preference only updates the image and marks it dirty if
+ * its data changed, so frequently saved values cost nothing until the next sync(). A sync appends a chunk with just
+ * the changed preferences to the current page, with a sequence number and a CRC per preference. Once the page would
+ * grow beyond \p page_size bytes, the whole image is written as the first chunk of the next page instead. Pages are
+ * used in turn, and an interrupted write only loses the chunk being written.
+ *
+ * Preferences that were loaded from a page but aren't used by the current firmware are kept, like they were with
+ * one storage key per preference.
+ */
+class PreferenceStore {
+ public:
+  PreferenceStore(PreferenceStorePages *pages, uint8_t page_count, size_t page_size)
+      : pages_(pages), page_count_(page_count), page_size_(page_size) {}
+
+  /// Load the newest valid page into the image.
+  void open();
+
+  /// Index of the preference \p key with \p length bytes, created if it doesn't exist yet. -1 if the image is full.
+  int add(uint32_t key, size_t length);
+  bool save(int slot, const uint8_t *data, size_t len);
+  /// Returns false if the preference was never saved.
+  bool load(int slot, uint8_t *data, size_t len) const;
+  uint32_t get_key(int slot) const { return this->slots_[slot].key; }
+
+  /// Whether open() found a valid page.
+  bool is_loaded() const { return this->loaded_; }
+  bool is_dirty() const { return this->dirty_; }
+  /// Append the changed preferences to the current page, or write the image to the next page if it is full.
+  bool sync();
+  /// Forget all preferences and erase all pages. Nothing is written anymore afterwards.
+  bool reset();
+
+  const PreferenceStoreStats &get_stats() const { return this->stats_; }
+
+ protected:
+  struct Slot {
+    uint32_t key;
+    uint16_t offset;
+    uint16_t length;
+    /// Has data, loaded from a page or saved.
+    bool valid : 1;
+    /// Changed since the last written page.
+    bool dirty : 1;
+  };
+
+  /// Append a chunk with the valid preferences to \p data, only the dirty ones if \p dirty_only is set.
+  uint16_t encode_chunk_(std::vector<uint8_t> &data, bool dirty_only) const;
+
+  PreferenceStorePages *pages_;
+  uint8_t page_count_;
+  size_t page_size_;
+  /// The page that holds the newest chunk.
+  uint8_t page_{0};
+  /// Bytes of chunks in page_, 0 if no page was loaded or written yet.
+  size_t page_used_{0};
+  /// Whether the next chunk can be appended to page_, it might end with a damaged chunk otherwise.
+  bool append_{false};
+  bool dirty_{false};
+  bool erased_{false};
+  bool loaded_{false};
+  uint32_t sequence_{0};
+  std::vector<Slot> slots_;
+  std::vector<uint8_t> image_;
+  PreferenceStoreStats stats_{};
+};
+
+}  // namespace esphome
@@ -0,0 +1,107 @@
+#include "esphome/core/profiler.h"
+
+#ifdef USE_PROFILER
+
+#include <algorithm>
+#include <cmath>
+
+namespace esphome {
+
+static uint8_t bucket_for_duration(uint32_t duration_us) {
+  if (duration_us < 2)
+    return 0;
+  // two buckets per power of two: [2^n, 1.5 * 2^n) and [1.5 * 2^n, 2^(n+1))
+  const uint8_t msb = 31 - __builtin_clz(duration_us);
+  const uint8_t half = (duration_us >> (msb - 1)) & 1;
+  const uint8_t bucket = msb * 2 - 1 + half;
+  return std::min<uint8_t>(bucket, ProfilerEntry::HISTOGRAM_BUCKETS - 1);
+}
+
+static uint32_t bucket_upper_bound(uint8_t bucket) {
+  if (bucket == 0)
+    return 2;
+  const uint8_t msb = (bucket + 1) / 2;
+  if ((bucket + 1) % 2 == 0)
+    return (1UL << msb) + (1UL << (msb - 1));
+  return 1UL << (msb + 1);
+}
+
+const char *ProfilerEntry::get_kind_str() const {
+  switch (this->kind) {
+    case ProfilerKind::SETUP:
+      return "setup";
+    case ProfilerKind::LOOP:
+      return "loop";
+    case ProfilerKind::SCHEDULER:
+      return "scheduler";
+    default:
+      return "";
+  }
+}
+
+uint32_t ProfilerEntry::get_percentile_us(float quantile) const {
+  uint32_t total = 0;
+  for (uint16_t value : this->histogram)
+    total += value;
+  if (total == 0)
+    return 0;
+  const uint32_t target = std::max<uint32_t>(1, std::ceil(total * quantile));
+  uint32_t seen = 0;
+  for (uint8_t i = 0; i < HISTOGRAM_BUCKETS; i++) {
+    seen += this->histogram[i];
+    if (seen >= target)
+      return std::min(bucket_upper_bound(i), this->max_us);
+  }
+  return this->max_us;
+}
+
+void Profiler::record(ProfilerKind kind, Component *component, uint32_t id, uint32_t duration_us) {
+  ProfilerEntry *entry = this->find_or_insert_(kind, component, id);
+  if (entry == nullptr) {
+    this->dropped_++;
+    return;
+  }
+  if (entry->count == 0 || duration_us < entry->min_us)
+    entry->min_us = duration_us;
+  entry->max_us = std::max(entry->max_us, duration_us);
+  entry->count++;
+  entry->total_us += duration_us;
+
+  uint16_t &bucket = entry->histogram[bucket_for_duration(duration_us)];
+  if (bucket == UINT16_MAX) {
+    // halve all buckets, this keeps the distribution and lets the histogram follow newer samples
+    for (uint16_t &value : entry->histogram)
+      value /= 2;
+  }
+  bucket++;
+}
+
+void Profiler::reset() {
+  for (auto &entry : this->entries_)
+    entry = ProfilerEntry{};
+  this->dropped_ = 0;
+}
+
+ProfilerEntry *Profiler::find_or_insert_(ProfilerKind kind, Component *component, uint32_t id) {
+  // open addressing with linear probing, the table never shrinks so no tombstones are needed
+  uint32_t hash = (static_cast<uint32_t>(reinterpret_cast<uintptr_t>(component)) >> 2) ^ id;
+  hash = (hash ^ static_cast<uint32_t>(kind)) * 2654435761UL;
+  const size_t size = this->entries_.size();
+  for (size_t probe = 0; probe < size; probe++) {
+    ProfilerEntry &entry = this->entries_[(hash + probe) % size];
+    if (!entry.used) {
+      entry.used = true;
+      entry.kind = kind;
+      entry.component = component;
+      entry.id = id;
+      return &entry;
+    }
+    if (entry.kind == kind && entry.component == component && entry.id == id)
+      return &entry;
+  }
+  return nullptr;
+}
+
+}  // namespace esphome
+
+#endif  // USE_PROFILER
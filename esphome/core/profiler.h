@@ -0,0 +1,70 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_PROFILER
+
+#include <array>
+#include <cstdint>
+
+#ifndef USE_PROFILER_MAX_ENTRIES
+#define USE_PROFILER_MAX_ENTRIES 48  // NOLINT
+#endif
+
+namespace esphome {
+
+class Component;
+
+/// What a profiler entry measures.
+enum class ProfilerKind : uint8_t {
+  SETUP = 0,
+  LOOP = 1,
+  SCHEDULER = 2,
+};
+
+/// Timing statistics of one component setup, component loop or scheduler callback.
+struct ProfilerEntry {
+  /// Number of histogram buckets. Buckets are half an octave wide, the last one also holds everything above ~65ms.
+  static constexpr uint8_t HISTOGRAM_BUCKETS = 32;
+
+  Component *component;
+  /// Scheduler name id (see Scheduler::name_id()) for SCHEDULER entries, 0 otherwise.
+  uint32_t id;
+  ProfilerKind kind;
+  bool used;
+  uint32_t count;
+  uint32_t min_us;
+  uint32_t max_us;
+  uint64_t total_us;
+  uint16_t histogram[HISTOGRAM_BUCKETS];
+
+  const char *get_kind_str() const;
+  uint32_t get_avg_us() const { return this->count == 0 ? 0 : this->total_us / this->count; }
+  /// Estimate the duration below which \p quantile (0..1) of all calls finished. Accurate to ~40%.
+  uint32_t get_percentile_us(float quantile) const;
+};
+
+/** Fixed-size table of per-component and per-scheduler-item execution times.
+ *
+ * Only compiled in when USE_PROFILER is defined; otherwise none of the timing code in Application and Scheduler
+ * exists. Entries are never evicted, records that don't fit into the table are counted as dropped.
+ */
+class Profiler {
+ public:
+  void record(ProfilerKind kind, Component *component, uint32_t id, uint32_t duration_us);
+  /// Clear all statistics.
+  void reset();
+
+  const std::array<ProfilerEntry, USE_PROFILER_MAX_ENTRIES> &get_entries() const { return this->entries_; }
+  uint32_t get_dropped() const { return this->dropped_; }
+
+ protected:
+  ProfilerEntry *find_or_insert_(ProfilerKind kind, Component *component, uint32_t id);
+
+  std::array<ProfilerEntry, USE_PROFILER_MAX_ENTRIES> entries_{};
+  uint32_t dropped_{0};
+};
+
+}  // namespace esphome
+
+#endif  // USE_PROFILER
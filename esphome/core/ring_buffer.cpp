@@ -1,50 +1,119 @@
 #include "ring_buffer.h"
 
+#include <algorithm>
+#include <cstring>
+
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 
-#ifdef USE_ESP32
-
-#include "helpers.h"
-
 namespace esphome {
 
 static const char *const TAG = "ring_buffer";
 
+RingBuffer::~RingBuffer() {
+  ExternalRAMAllocator<uint8_t> allocator(ExternalRAMAllocator<uint8_t>::ALLOW_FAILURE);
+  allocator.deallocate(this->storage_, this->size_);
+}
+
 std::unique_ptr<RingBuffer> RingBuffer::create(size_t len) {
   std::unique_ptr<RingBuffer> rb = make_unique<RingBuffer>();
 
   ExternalRAMAllocator<uint8_t> allocator(ExternalRAMAllocator<uint8_t>::ALLOW_FAILURE);
-  rb->storage_ = allocator.allocate(len + 1);
+  rb->storage_ = allocator.allocate(len);
   if (rb->storage_ == nullptr) {
     return nullptr;
   }
+  rb->size_ = len;
 
-  rb->handle_ = xStreamBufferCreateStatic(len + 1, 0, rb->storage_, &rb->structure_);
-  ESP_LOGD(TAG, "Created ring buffer with size %u", len);
+  ESP_LOGD(TAG, "Created ring buffer with size %zu", len);
   return rb;
 }
 
+size_t RingBuffer::read(void *data, size_t len) {
+  auto *dst = static_cast<uint8_t *>(data);
+  size_t total = 0;
+  // at most two spans, before and after the wrap around
+  while (total < len) {
+    size_t span;
+    const uint8_t *src = this->peek(&span);
+    if (span == 0)
+      break;
+    span = std::min(span, len - total);
+    memcpy(dst + total, src, span);
+    this->consume(span);
+    total += span;
+  }
+  return total;
+}
+
+#ifdef USE_ESP32
 size_t RingBuffer::read(void *data, size_t len, TickType_t ticks_to_wait) {
-  return xStreamBufferReceive(this->handle_, data, len, ticks_to_wait);
+  TickType_t start = xTaskGetTickCount();
+  while (this->available() == 0 && xTaskGetTickCount() - start < ticks_to_wait)
+    vTaskDelay(1);
+  return this->read(data, len);
 }
+#endif
 
-size_t RingBuffer::write(void *data, size_t len) {
+size_t RingBuffer::write(const void *data, size_t len) {
+  const auto *src = static_cast<const uint8_t *>(data);
+  if (len > this->size_) {
+    // only the newest data fits
+    src += len - this->size_;
+    len = this->size_;
+  }
   size_t free = this->free();
-  if (free < len) {
-    size_t needed = len - free;
-    uint8_t discard[needed];
-    xStreamBufferReceive(this->handle_, discard, needed, 0);
+  if (free < len)
+    this->consume(len - free);
+
+  size_t total = 0;
+  while (total < len) {
+    size_t span;
+    uint8_t *dst = this->acquire_write(&span);
+    span = std::min(span, len - total);
+    memcpy(dst, src + total, span);
+    this->commit(span);
+    total += span;
   }
-  return xStreamBufferSend(this->handle_, data, len, 0);
+  return total;
 }
 
-size_t RingBuffer::available() const { return xStreamBufferBytesAvailable(this->handle_); }
+uint8_t *RingBuffer::acquire_write(size_t *len) {
+  size_t write = this->write_.load(std::memory_order_relaxed);
+  size_t read = this->read_.load(std::memory_order_acquire);
+  size_t offset = this->offset_(write);
+  *len = std::min(this->size_ - this->used_(read, write), this->size_ - offset);
+  return this->storage_ + offset;
+}
 
-size_t RingBuffer::free() const { return xStreamBufferSpacesAvailable(this->handle_); }
+void RingBuffer::commit(size_t len) {
+  size_t write = this->write_.load(std::memory_order_relaxed);
+  this->write_.store(this->advance_(write, len), std::memory_order_release);
+}
 
-BaseType_t RingBuffer::reset() { return xStreamBufferReset(this->handle_); }
+const uint8_t *RingBuffer::peek(size_t *len) const {
+  size_t read = this->read_.load(std::memory_order_relaxed);
+  size_t write = this->write_.load(std::memory_order_acquire);
+  size_t offset = this->offset_(read);
+  *len = std::min(this->used_(read, write), this->size_ - offset);
+  return this->storage_ + offset;
+}
 
-}  // namespace esphome
+void RingBuffer::consume(size_t len) {
+  size_t read = this->read_.load(std::memory_order_relaxed);
+  this->read_.store(this->advance_(read, len), std::memory_order_release);
+}
 
-#endif
+size_t RingBuffer::available() const {
+  return this->used_(this->read_.load(std::memory_order_acquire), this->write_.load(std::memory_order_acquire));
+}
+
+size_t RingBuffer::free() const { return this->size_ - this->available(); }
+
+bool RingBuffer::reset() {
+  this->read_.store(0, std::memory_order_relaxed);
+  this->write_.store(0, std::memory_order_release);
+  return true;
+}
+
+}  // namespace esphome
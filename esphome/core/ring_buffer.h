@@ -1,34 +1,73 @@
 #pragma once
 
-#ifdef USE_ESP32
-
-#include <freertos/FreeRTOS.h>
-#include <freertos/stream_buffer.h>
-
+#include <atomic>
 #include <cinttypes>
+#include <cstddef>
 #include <memory>
 
+#ifdef USE_ESP32
+#include <freertos/FreeRTOS.h>
+#endif
+
 namespace esphome {
 
+/** Lock-free ring buffer for a single producer and a single consumer.
+ *
+ * The producer only moves the write position and the consumer only moves the read position, so one task (or ISR)
+ * may write while another one reads without any locking. Besides copying through write() and read(), both sides can
+ * work in place: acquire_write() hands out the largest contiguous free span to fill and commit() publishes it,
+ * peek() hands out the largest contiguous readable span and consume() releases it. A span ends where the storage
+ * wraps around, so a second call may return the rest.
+ *
+ * write() drops the oldest data when the buffer is full and reset() clears both positions; these touch the read side
+ * and must not run concurrently with the consumer.
+ */
 class RingBuffer {
  public:
-  size_t read(void *data, size_t len, TickType_t ticks_to_wait = 0);
+  ~RingBuffer();
 
-  size_t write(void *data, size_t len);
+  /// Copy up to len bytes out of the buffer, returns the number of bytes copied.
+  size_t read(void *data, size_t len);
+#ifdef USE_ESP32
+  /// Like read(), but wait up to ticks_to_wait for data to arrive when the buffer is empty.
+  size_t read(void *data, size_t len, TickType_t ticks_to_wait);
+#endif
+
+  /// Copy len bytes into the buffer, discarding the oldest data if it doesn't fit.
+  size_t write(const void *data, size_t len);
+
+  /// Contiguous free space at the write position, sets len to its size.
+  uint8_t *acquire_write(size_t *len);
+  /// Make len bytes written to the span from acquire_write() available to the consumer.
+  void commit(size_t len);
+
+  /// Contiguous readable data at the read position, sets len to its size.
+  const uint8_t *peek(size_t *len) const;
+  /// Release len bytes of the span from peek() back to the producer.
+  void consume(size_t len);
 
   size_t available() const;
   size_t free() const;
 
-  BaseType_t reset();
+  bool reset();
 
   static std::unique_ptr<RingBuffer> create(size_t len);
 
  protected:
-  StreamBufferHandle_t handle_;
-  StaticStreamBuffer_t structure_;
-  uint8_t *storage_;
+  /// Positions run over [0, 2 * size_) so a full buffer can be told apart from an empty one without a spare byte.
+  size_t used_(size_t read, size_t write) const {
+    return write >= read ? write - read : write + 2 * this->size_ - read;
+  }
+  size_t offset_(size_t pos) const { return pos < this->size_ ? pos : pos - this->size_; }
+  size_t advance_(size_t pos, size_t len) const {
+    pos += len;
+    return pos < 2 * this->size_ ? pos : pos - 2 * this->size_;
+  }
+
+  uint8_t *storage_{nullptr};
+  size_t size_{0};
+  std::atomic<size_t> read_{0};
+  std::atomic<size_t> write_{0};
 };
 
 }  // namespace esphome
-
-#endif
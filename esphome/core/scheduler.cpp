@@ -1,4 +1,5 @@
 #include "scheduler.h"
+#include "esphome/core/application.h"
 #include "esphome/core/log.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/hal.h"
@@ -19,52 +20,50 @@ static const uint32_t MAX_LOGICALLY_DELETED_ITEMS = 10;
 // iterating over them from the loop task is fine; but iterating from any other context requires the lock to be held to
 // avoid the main thread modifying the list while it is being accessed.
 
-void HOT Scheduler::set_timeout(Component *component, const std::string &name, uint32_t timeout,
-                                std::function<void()> func) {
+Scheduler::Handle HOT Scheduler::set_timeout_(Component *component, uint32_t id, const char *name, uint32_t timeout,
+                                              Delegate<void()> func) {
   const uint32_t now = this->millis_();
 
-  if (!name.empty())
-    this->cancel_timeout(component, name);
+  if (id != 0)
+    this->cancel_item_(component, id, name, SchedulerItem::TIMEOUT);
 
   if (timeout == SCHEDULER_DONT_RUN)
-    return;
+    return {};
 
-  ESP_LOGVV(TAG, "set_timeout(name='%s', timeout=%" PRIu32 ")", name.c_str(), timeout);
+  ESP_LOGVV(TAG, "set_timeout(name='%s', timeout=%" PRIu32 ")", name, timeout);
 
-  auto item = make_unique<SchedulerItem>();
+  auto item = this->acquire_item_();
   item->component = component;
-  item->name = name;
+  item->name_id = id;
+  item->name.assign(name);
   item->type = SchedulerItem::TIMEOUT;
   item->timeout = timeout;
   item->last_execution = now;
   item->last_execution_major = this->millis_major_;
   item->callback = std::move(func);
-  item->remove = false;
-  this->push_(std::move(item));
+  return this->push_(std::move(item));
 }
-bool HOT Scheduler::cancel_timeout(Component *component, const std::string &name) {
-  return this->cancel_item_(component, name, SchedulerItem::TIMEOUT);
-}
-void HOT Scheduler::set_interval(Component *component, const std::string &name, uint32_t interval,
-                                 std::function<void()> func) {
+Scheduler::Handle HOT Scheduler::set_interval_(Component *component, uint32_t id, const char *name,
+                                               uint32_t interval, Delegate<void()> func) {
   const uint32_t now = this->millis_();
 
-  if (!name.empty())
-    this->cancel_interval(component, name);
+  if (id != 0)
+    this->cancel_item_(component, id, name, SchedulerItem::INTERVAL);
 
   if (interval == SCHEDULER_DONT_RUN)
-    return;
+    return {};
 
   // only put offset in lower half
   uint32_t offset = 0;
   if (interval != 0)
     offset = (random_uint32() % interval) / 2;
 
-  ESP_LOGVV(TAG, "set_interval(name='%s', interval=%" PRIu32 ", offset=%" PRIu32 ")", name.c_str(), interval, offset);
+  ESP_LOGVV(TAG, "set_interval(name='%s', interval=%" PRIu32 ", offset=%" PRIu32 ")", name, interval, offset);
 
-  auto item = make_unique<SchedulerItem>();
+  auto item = this->acquire_item_();
   item->component = component;
-  item->name = name;
+  item->name_id = id;
+  item->name.assign(name);
   item->type = SchedulerItem::INTERVAL;
   item->interval = interval;
   item->last_execution = now - offset - interval;
@@ -72,15 +71,23 @@ void HOT Scheduler::set_interval(Component *component, const std::string &name,
   if (item->last_execution > now)
     item->last_execution_major--;
   item->callback = std::move(func);
-  item->remove = false;
-  this->push_(std::move(item));
+  return this->push_(std::move(item));
 }
-bool HOT Scheduler::cancel_interval(Component *component, const std::string &name) {
-  return this->cancel_item_(component, name, SchedulerItem::INTERVAL);
+bool HOT Scheduler::cancel(const Handle &handle) {
+  if (handle.item_ == nullptr)
+    return false;
+  LockGuard guard{this->lock_};
+  SchedulerItem *item = handle.item_;
+  if (item->generation != handle.generation_ || item->remove)
+    return false;
+  item->remove = true;
+  if (item->in_heap)
+    to_remove_++;
+  return true;
 }
 
 struct RetryArgs {
-  std::function<RetryResult(uint8_t)> func;
+  Delegate<RetryResult(uint8_t)> func;
   uint8_t retry_countdown;
   uint32_t current_interval;
   Component *component;
@@ -89,6 +96,8 @@ struct RetryArgs {
   Scheduler *scheduler;
 };
 
+static std::string retry_name(const std::string &name) { return name.empty() ? name : "retry$" + name; }
+
 static void retry_handler(const std::shared_ptr<RetryArgs> &args) {
   RetryResult const retry_result = args->func(--args->retry_countdown);
   if (retry_result == RetryResult::DONE || args->retry_countdown <= 0)
@@ -100,7 +109,7 @@ static void retry_handler(const std::shared_ptr<RetryArgs> &args) {
 }
 
 void HOT Scheduler::set_retry(Component *component, const std::string &name, uint32_t initial_wait_time,
-                              uint8_t max_attempts, std::function<RetryResult(uint8_t)> func,
+                              uint8_t max_attempts, Delegate<RetryResult(uint8_t)> func,
                               float backoff_increase_factor) {
   if (!name.empty())
     this->cancel_retry(component, name);
@@ -123,7 +132,7 @@ void HOT Scheduler::set_retry(Component *component, const std::string &name, uin
   args->retry_countdown = max_attempts;
   args->current_interval = initial_wait_time;
   args->component = component;
-  args->name = "retry$" + name;
+  args->name = retry_name(name);
   args->backoff_increase_factor = backoff_increase_factor;
   args->scheduler = this;
 
@@ -131,7 +140,7 @@ void HOT Scheduler::set_retry(Component *component, const std::string &name, uin
   this->set_timeout(component, args->name, 0, [args]() { retry_handler(args); });
 }
 bool HOT Scheduler::cancel_retry(Component *component, const std::string &name) {
-  return this->cancel_timeout(component, "retry$" + name);
+  return this->cancel_timeout(component, retry_name(name));
 }
 
 optional<uint32_t> HOT Scheduler::next_schedule_in() {
@@ -231,7 +240,15 @@ void HOT Scheduler::call() {
       //  - timeouts/intervals get cancelled
       {
         WarnIfComponentBlockingGuard guard{item->component};
+#ifdef USE_PROFILER
+        Component *component = item->component;
+        const uint32_t name_id = item->name_id;
+        const uint32_t callback_start = micros();
+        item->callback();
+        App.profiler.record(ProfilerKind::SCHEDULER, component, name_id, micros() - callback_start);
+#else
         item->callback();
+#endif
       }
     }
 
@@ -244,25 +261,32 @@ void HOT Scheduler::call() {
       // Only pop after function call, this ensures we were reachable
       // during the function call and know if we were cancelled.
       this->pop_raw_();
-
-      this->lock_.unlock();
+      item->in_heap = false;
 
       if (item->remove) {
         // We were removed/cancelled in the function call, stop
         to_remove_--;
+        this->recycle_item_(std::move(item));
+        this->lock_.unlock();
+        continue;
+      }
+
+      if (item->type == SchedulerItem::TIMEOUT) {
+        this->recycle_item_(std::move(item));
+        this->lock_.unlock();
         continue;
       }
 
-      if (item->type == SchedulerItem::INTERVAL) {
-        if (item->interval != 0) {
-          const uint32_t before = item->last_execution;
-          const uint32_t amount = (now - item->last_execution) / item->interval;
-          item->last_execution += amount * item->interval;
-          if (item->last_execution < before)
-            item->last_execution_major++;
-        }
-        this->push_(std::move(item));
+      this->lock_.unlock();
+
+      if (item->interval != 0) {
+        const uint32_t before = item->last_execution;
+        const uint32_t amount = (now - item->last_execution) / item->interval;
+        item->last_execution += amount * item->interval;
+        if (item->last_execution < before)
+          item->last_execution_major++;
       }
+      this->push_(std::move(item));
     }
   }
 
@@ -272,9 +296,11 @@ void HOT Scheduler::process_to_add() {
   LockGuard guard{this->lock_};
   for (auto &it : this->to_add_) {
     if (it->remove) {
+      this->recycle_item_(std::move(it));
       continue;
     }
 
+    it->in_heap = true;
     this->items_.push_back(std::move(it));
     std::push_heap(this->items_.begin(), this->items_.end(), SchedulerItem::cmp);
   }
@@ -296,25 +322,56 @@ void HOT Scheduler::cleanup_() {
 }
 void HOT Scheduler::pop_raw_() {
   std::pop_heap(this->items_.begin(), this->items_.end(), SchedulerItem::cmp);
+  // Callers that still need the item move it out before popping; anything left here is done and goes to the pool.
+  if (this->items_.back() != nullptr)
+    this->recycle_item_(std::move(this->items_.back()));
   this->items_.pop_back();
 }
-void HOT Scheduler::push_(std::unique_ptr<Scheduler::SchedulerItem> item) {
+std::unique_ptr<Scheduler::SchedulerItem> HOT Scheduler::acquire_item_() {
+  LockGuard guard{this->lock_};
+  std::unique_ptr<SchedulerItem> item;
+  if (this->pool_.empty()) {
+    item = make_unique<SchedulerItem>();
+    item->generation = 0;
+  } else {
+    item = std::move(this->pool_.back());
+    this->pool_.pop_back();
+  }
+  item->generation++;
+  item->remove = false;
+  item->in_heap = false;
+  return item;
+}
+void HOT Scheduler::recycle_item_(std::unique_ptr<SchedulerItem> item) {
+  // lock_ must be held by the caller
+  item->remove = true;
+  item->in_heap = false;
+  // release any state captured by the callback now rather than when the item is reused
+  item->callback = nullptr;
+  this->pool_.push_back(std::move(item));
+}
+Scheduler::Handle HOT Scheduler::push_(std::unique_ptr<Scheduler::SchedulerItem> item) {
   LockGuard guard{this->lock_};
+  Handle handle{item.get(), item->generation};
   this->to_add_.push_back(std::move(item));
+  return handle;
 }
-bool HOT Scheduler::cancel_item_(Component *component, const std::string &name, Scheduler::SchedulerItem::Type type) {
+bool HOT Scheduler::cancel_item_(Component *component, uint32_t id, const char *name,
+                                 Scheduler::SchedulerItem::Type type) {
+  if (id == 0)
+    return false;
   // obtain lock because this function iterates and can be called from non-loop task context
   LockGuard guard{this->lock_};
   bool ret = false;
   for (auto &it : this->items_) {
-    if (it->component == component && it->name == name && it->type == type && !it->remove) {
+    if (it->name_id == id && it->component == component && it->type == type && !it->remove && it->name == name) {
       to_remove_++;
       it->remove = true;
       ret = true;
     }
   }
   for (auto &it : this->to_add_) {
-    if (it->component == component && it->name == name && it->type == type) {
+    if (it->name_id == id && it->component == component && it->type == type && it->name == name) {
       it->remove = true;
       ret = true;
     }
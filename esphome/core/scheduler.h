@@ -11,14 +11,66 @@ namespace esphome {
 class Component;
 
 class Scheduler {
+ protected:
+  struct SchedulerItem;
+
  public:
-  void set_timeout(Component *component, const std::string &name, uint32_t timeout, std::function<void()> func);
-  bool cancel_timeout(Component *component, const std::string &name);
-  void set_interval(Component *component, const std::string &name, uint32_t interval, std::function<void()> func);
-  bool cancel_interval(Component *component, const std::string &name);
+  /** Reference to a single scheduled timeout/interval, returned by set_timeout() and set_interval().
+   *
+   * Cancelling through a handle is O(1) and doesn't need a name. A handle stays safe to use after the item has run or
+   * was cancelled: scheduler items are recycled but never freed, and a stale handle simply doesn't match anymore.
+   */
+  class Handle {
+   public:
+    Handle() = default;
+    bool is_valid() const { return this->item_ != nullptr; }
+
+   protected:
+    friend class Scheduler;
+    Handle(SchedulerItem *item, uint32_t generation) : item_(item), generation_(generation) {}
+
+    SchedulerItem *item_{nullptr};
+    uint32_t generation_{0};
+  };
+
+  /** Convert a timeout/interval name to the id used to look it up. Empty names map to 0 (not cancellable).
+   *
+   * Items are found by the FNV-1 hash of their name, computed at compile time for string literals, and a hash match is
+   * confirmed by comparing the name stored in the item, so names that happen to collide never affect each other.
+   */
+  static uint32_t name_id(const std::string &name) { return name.empty() ? 0 : fnv1_hash(name); }
+  static constexpr14 uint32_t name_id(const char *name) { return *name == '\0' ? 0 : fnv1_hash(name); }
+
+  Handle set_timeout(Component *component, const std::string &name, uint32_t timeout, Delegate<void()> func) {
+    return this->set_timeout_(component, name_id(name), name.c_str(), timeout, std::move(func));
+  }
+  Handle set_timeout(Component *component, const char *name, uint32_t timeout, Delegate<void()> func) {
+    return this->set_timeout_(component, name_id(name), name, timeout, std::move(func));
+  }
+  bool cancel_timeout(Component *component, const std::string &name) {
+    return this->cancel_item_(component, name_id(name), name.c_str(), SchedulerItem::TIMEOUT);
+  }
+  bool cancel_timeout(Component *component, const char *name) {
+    return this->cancel_item_(component, name_id(name), name, SchedulerItem::TIMEOUT);
+  }
+  Handle set_interval(Component *component, const std::string &name, uint32_t interval, Delegate<void()> func) {
+    return this->set_interval_(component, name_id(name), name.c_str(), interval, std::move(func));
+  }
+  Handle set_interval(Component *component, const char *name, uint32_t interval, Delegate<void()> func) {
+    return this->set_interval_(component, name_id(name), name, interval, std::move(func));
+  }
+  bool cancel_interval(Component *component, const std::string &name) {
+    return this->cancel_item_(component, name_id(name), name.c_str(), SchedulerItem::INTERVAL);
+  }
+  bool cancel_interval(Component *component, const char *name) {
+    return this->cancel_item_(component, name_id(name), name, SchedulerItem::INTERVAL);
+  }
+
+  /// Cancel the timeout/interval referenced by \p handle in O(1). Returns false if it already ran or was cancelled.
+  bool cancel(const Handle &handle);
 
   void set_retry(Component *component, const std::string &name, uint32_t initial_wait_time, uint8_t max_attempts,
-                 std::function<RetryResult(uint8_t)> func, float backoff_increase_factor = 1.0f);
+                 Delegate<RetryResult(uint8_t)> func, float backoff_increase_factor = 1.0f);
   bool cancel_retry(Component *component, const std::string &name);
 
   optional<uint32_t> next_schedule_in();
@@ -30,6 +82,8 @@ class Scheduler {
  protected:
   struct SchedulerItem {
     Component *component;
+    uint32_t name_id;
+    /// Kept to confirm name_id matches. Pooled items reuse its capacity, so re-arming a timer doesn't allocate.
     std::string name;
     enum Type { TIMEOUT, INTERVAL } type;
     union {
@@ -37,8 +91,12 @@ class Scheduler {
       uint32_t timeout;
     };
     uint32_t last_execution;
-    std::function<void()> callback;
+    Delegate<void()> callback;
+    /// Incremented every time this item is taken from the pool, so that stale handles can be detected.
+    uint32_t generation;
     bool remove;
+    /// Whether this item lives in `items_` (as opposed to `to_add_` or the pool).
+    bool in_heap;
     uint8_t last_execution_major;
 
     inline uint32_t next_execution() { return this->last_execution + this->timeout; }
@@ -63,11 +121,15 @@ class Scheduler {
     }
   };
 
+  Handle set_timeout_(Component *component, uint32_t id, const char *name, uint32_t timeout, Delegate<void()> func);
+  Handle set_interval_(Component *component, uint32_t id, const char *name, uint32_t interval, Delegate<void()> func);
   uint32_t millis_();
   void cleanup_();
   void pop_raw_();
-  void push_(std::unique_ptr<SchedulerItem> item);
-  bool cancel_item_(Component *component, const std::string &name, SchedulerItem::Type type);
+  std::unique_ptr<SchedulerItem> acquire_item_();
+  void recycle_item_(std::unique_ptr<SchedulerItem> item);
+  Handle push_(std::unique_ptr<SchedulerItem> item);
+  bool cancel_item_(Component *component, uint32_t id, const char *name, SchedulerItem::Type type);
   bool empty_() {
     this->cleanup_();
     return this->items_.empty();
@@ -76,6 +138,9 @@ class Scheduler {
   Mutex lock_;
   std::vector<std::unique_ptr<SchedulerItem>> items_;
   std::vector<std::unique_ptr<SchedulerItem>> to_add_;
+  /// Items that have run or were cancelled, reused by later set_timeout()/set_interval() calls. Items are never freed,
+  /// so the pool grows to the peak number of concurrently scheduled items and arming a timer stops allocating.
+  std::vector<std::unique_ptr<SchedulerItem>> pool_;
   uint32_t last_millis_{0};
   uint8_t millis_major_{0};
   uint32_t to_remove_{0};